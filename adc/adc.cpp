@@ -211,6 +211,22 @@ void Adc::initializeDc(uint32_t adcModule, uint32_t dc, uint32_t bitField, uint3
 
 }
 
+/**
+ * @brief Selects the PWM module of the generator used as a sample sequencer
+ *        trigger source. Sample sequencers triggered by \c pwmGenN sample on
+ *        the counter events selected with \c Pwm::setAdcTrigger. Call before
+ *        initializing the sample sequencer.
+ * 
+ * @param adcModule ADC module of the sample sequencer
+ * @param pwmGenerator generator 0 to 3
+ * @param pwmModule PWM module 0 or 1 of the generator
+ */
+void Adc::selectPwmTriggerModule(uint32_t adcModule, uint32_t pwmGenerator, uint32_t pwmModule)
+{
+    //PSn
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(adc0BaseAddress + (adcModule * 0x1000) + ADCTSSEL_OFFSET)), pwmModule, 4 + (pwmGenerator * 8), 2, RW);
+}
+
 void Adc::pollStatus(void)
 {
     if(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + ADCRIS_OFFSET)), sampleSequencer, 1, RO) == (uint32_t)setORClear::set)
@@ -245,6 +261,32 @@ uint32_t Adc::getAdcSample(void)
     return(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + (ADCSSFIFO0_OFFSET + (ssOffset * sampleSequencer)))), 0, 11 + 1, RO));
 }
 
+/**
+ * @brief Allocates the µDMA channel of the sample sequencer. The sample 
+ *        sequencer requests a transfer each time it completes a sequence,
+ *        the destination is read from \c getFifoAddress.
+ * 
+ * @param dma channel to be initialized for this sample sequencer
+ * @return false if the channel is in use by another driver
+ */
+bool Adc::attachDma(Dma* dma)
+{
+    static const dmaPeripheral sequencerDmaPeripheral[2][4] = {
+        {dmaPeripheral::adc0Ss0, dmaPeripheral::adc0Ss1, dmaPeripheral::adc0Ss2, dmaPeripheral::adc0Ss3},
+        {dmaPeripheral::adc1Ss0, dmaPeripheral::adc1Ss1, dmaPeripheral::adc1Ss2, dmaPeripheral::adc1Ss3}};
+
+    return((*dma).allocate(sequencerDmaPeripheral[adcModule][sampleSequencer]));
+}
+
+/**
+ * @brief Address of the result FIFO of the sample sequencer, the source of
+ *        its µDMA transfers.
+ */
+volatile uint32_t* Adc::getFifoAddress(void)
+{
+    return((volatile uint32_t*)(baseAddress + (ADCSSFIFO0_OFFSET + (ssOffset * sampleSequencer))));
+}
+
 void Adc::clearInterrupt(void)
 {
     Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + ADCISC_OFFSET)), (uint32_t)setORClear::set, sampleSequencer, 1, RW1C);
@@ -300,7 +342,7 @@ void Adc::initialization(void)
      * 1.A When using a PWM generator as the trigger source, use the ADC 
      * Trigger Source Select (ADCTSSEL) register to specify in which PWM module 
      * the generator is located. The default register reset selects PWM module 
-     * 0 for all generators.
+     * 0 for all generators. This is set with selectPwmTriggerModule.
      */
 
 
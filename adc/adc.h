@@ -86,6 +86,7 @@
 #define ADC_H
 
 #include "../systemControl/systemControl.h"
+#include "../udma/udma.h"
 
 enum class adcModule : uint32_t{module0, module1};
 
@@ -159,10 +160,12 @@ class Adc
         void enableSampleSequencerDc(uint32_t dcOperation, uint32_t dcSelect);
 
         static void initializeDc(uint32_t adcModule, uint32_t dc, uint32_t bitField, uint32_t highBand, uint32_t lowBand);
+        static void selectPwmTriggerModule(uint32_t adcModule, uint32_t pwmGenerator, uint32_t pwmModule);
 
         void pollStatus(void);
         void pollDigitalComparator(void);
-        // void initializeDmaOperation(void);
+        bool attachDma(Dma* dma);
+        volatile uint32_t* getFifoAddress(void);
 
         void initiateSampling(void);
 
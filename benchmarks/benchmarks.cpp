@@ -0,0 +1,85 @@
+/**
+ * @file benchmarks.cpp
+ * @brief TM4C123GH6PM On Target Driver Benchmarks
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "benchmarks.h"
+
+/**
+ * Benchmarks run in order, the slots are reported after each one and reset
+ * before the next one.
+ */
+static void (*const benchmark[])(void) = {
+    benchmarkProfiler, benchmarkTimerDispatch, benchmarkPwmUpdate, benchmarkSpaceVectorPwm, benchmarkPwmStream, benchmarkPingPong, benchmarkDmaMemory};
+
+/**
+ * Debug Halting Control and Status Register, C_DEBUGEN is set while a 
+ * debugger is attached.
+ */
+static const uint32_t DHCSR = 0xE000EDF0;
+
+/**
+ * @brief Halts on a breakpoint so the slots of the benchmark that just ran
+ *        can be read from the debugger. Skipped without a debugger, where a
+ *        breakpoint would raise a hard fault.
+ */
+static void stopForDebugger(void)
+{
+    if(((*((volatile uint32_t*)DHCSR)) & 0x1) != 0)
+    {
+        __asm volatile("bkpt #0");
+    }
+}
+
+extern "C" void SystemInit(void)
+{
+    SystemControl::initializeGPIOHB();
+    SystemControl::initializeClock(_80MHz);
+}
+
+int main(void)
+{
+    Profiler::initialize();
+    Nvic::enableInterrupts();
+
+    for(uint32_t i = 0; i < (sizeof(benchmark)/sizeof(benchmark[0])); i++)
+    {
+        if(i != 0)
+        {
+            Profiler::reset();
+        }
+
+        benchmark[i]();
+        Profiler::report();
+        stopForDebugger();
+    }
+
+    while(1)
+    {
+        //Done, the slots of the last benchmark are never reset
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file benchmarks.h
+ * @brief TM4C123GH6PM On Target Driver Benchmarks
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @section benchmarksDescription Benchmarks Description
+ * 
+ * The benchmarks measure the drivers on the board with the \c Profiler and
+ * \c ScopedProfile. \c make benchmarks.elf builds them in place of the 
+ * example main, and \c make benchmarks.elf PROFILER_DEFS=-DPROFILER_SEMIHOSTING
+ * prints the slots of each benchmark over semihosting with a debugger 
+ * attached. Without semihosting the slots are read with the getters of the
+ * \c Profiler from the debugger.
+ * 
+ * Each benchmark names and fills the slots it needs, main then reports the
+ * slots and, with a debugger attached, halts on a breakpoint so they can be
+ * read before they are reset for the next benchmark. The slots of the last
+ * benchmark are kept. Every benchmark runs with the system clock at 80 MHz.
+ */
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include "../corePeripherals/profiler/scopedProfile.h"
+#include "../corePeripherals/nvic/nvic.h"
+#include "../systemControl/systemControl.h"
+
+void benchmarkProfiler(void);
+void benchmarkTimerDispatch(void);
+void benchmarkPwmUpdate(void);
+void benchmarkSpaceVectorPwm(void);
+void benchmarkPwmStream(void);
+void benchmarkPingPong(void);
+void benchmarkDmaMemory(void);
+
+#endif //BENCHMARKS_H
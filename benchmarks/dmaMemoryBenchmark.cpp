@@ -0,0 +1,117 @@
+/**
+ * @file dmaMemoryBenchmark.cpp
+ * @brief µDMA Memory Copy and Fill Benchmark
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include <cstring>
+#include "benchmarks.h"
+#include "../udma/dmaMemory.h"
+
+/**
+ * The µDMA can not read flash, so both ends of a copy are in the 32 KB of 
+ * SRAM and copies go from the first half of the buffer to the second. 
+ * Copies stop at 8 KB, fills use the whole 16 KB.
+ */
+static uint8_t buffer[16384] __attribute__((aligned(4)));
+
+static const uint32_t copySizes[4] = {256, 1024, 4096, 8192};
+
+static volatile bool asyncDone;
+
+static void markDone(void* context)
+{
+    (void)context;
+    asyncDone = true;
+}
+
+/**
+ * @brief Measures the throughput of \c DmaMemory against memcpy and memset,
+ *        and the CPU left free by an asynchronous copy. Slots 0 to 7 hold 
+ *        the cycles of each copy size, memcpy then DmaMemory::copy, slots 8
+ *        and 9 a 16 KB fill with memset then DmaMemory::set. Slot 10 is the
+ *        cycles copyAsync of 8 KB keeps the CPU and slot 11 the cycles to its
+ *        callback, the CPU is free for the difference. Throughput is the 
+ *        size over the cycles at 80 MHz.
+ */
+void benchmarkDmaMemory(void)
+{
+    static const char* const copyName[8] = {"memcpy 256", "memcpy 1K", "memcpy 4K", "memcpy 8K", "dma copy 256", "dma copy 1K", "dma copy 4K", "dma copy 8K"};
+
+    for(uint32_t i = 0; i < 8; i++)
+    {
+        Profiler::nameSlot(i, copyName[i]);
+    }
+
+    Profiler::nameSlot(8, "memset 16K");
+    Profiler::nameSlot(9, "dma set 16K");
+    Profiler::nameSlot(10, "dma copyAsync 8K, cpu busy");
+    Profiler::nameSlot(11, "dma copyAsync 8K, to callback");
+
+    if(!DmaMemory::initialize(1))
+    {
+        return;
+    }
+
+    for(uint32_t run = 0; run < 10; run++)
+    {
+        for(uint32_t size = 0; size < 4; size++)
+        {
+            {
+                ScopedProfile profile(size);
+                memcpy(&buffer[8192], &buffer[0], copySizes[size]);
+            }
+
+            {
+                ScopedProfile profile(4 + size);
+                DmaMemory::copy(&buffer[8192], &buffer[0], copySizes[size]);
+            }
+        }
+
+        {
+            ScopedProfile profile(8);
+            memset(buffer, run, sizeof(buffer));
+        }
+
+        {
+            ScopedProfile profile(9);
+            DmaMemory::set(buffer, run, sizeof(buffer));
+        }
+
+        asyncDone = false;
+        uint32_t start = Profiler::cycles();
+
+        DmaMemory::copyAsync(&buffer[8192], &buffer[0], 8192, markDone, nullptr);
+        Profiler::record(10, Profiler::cycles() - start);
+
+        while(!asyncDone)
+        {
+            //The CPU is free here
+        }
+
+        Profiler::record(11, Profiler::cycles() - start);
+    }
+}
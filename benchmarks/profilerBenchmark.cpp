@@ -0,0 +1,58 @@
+/**
+ * @file profilerBenchmark.cpp
+ * @brief Profiler Benchmark
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "benchmarks.h"
+
+/**
+ * @brief Measures the profiler itself. An empty scope should record 0 
+ *        cycles once the overhead is subtracted, a scope of 100 NOPs 100 
+ *        cycles, and \c record the cost of recording a measurement.
+ */
+void benchmarkProfiler(void)
+{
+    Profiler::nameSlot(0, "empty scope");
+    Profiler::nameSlot(1, "100 nop scope");
+    Profiler::nameSlot(2, "record");
+
+    for(uint32_t i = 0; i < 1000; i++)
+    {
+        {
+            ScopedProfile profile(0);
+        }
+
+        {
+            ScopedProfile profile(1);
+            __asm volatile(".rept 100\n\tnop\n\t.endr");
+        }
+
+        uint32_t start = Profiler::cycles();
+        Profiler::record(3, 0);
+        Profiler::record(2, Profiler::cycles() - start);
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file pwmBenchmark.cpp
+ * @brief PWM Benchmark
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "benchmarks.h"
+#include "../pwm/spaceVectorPwm.h"
+
+static Pwm updatedPwm;
+static Pwm phasePwm[3];
+static SpaceVectorPwm inverter;
+
+/**
+ * @brief Measures the cycles of each runtime update of a PWM pin running at
+ *        20 kHz, the rate of a control loop interrupt.
+ */
+void benchmarkPwmUpdate(void)
+{
+    Profiler::nameSlot(0, "pwm setDuty");
+    Profiler::nameSlot(1, "pwm setCompare");
+    Profiler::nameSlot(2, "pwm setPeriod");
+    Profiler::nameSlot(3, "pwm setDutyQ16");
+
+    updatedPwm.initializeFrequency(7, module1, 20000, 32768, countDirectionPwm::down);
+    uint32_t load = updatedPwm.getResolution() - 1;
+
+    for(uint32_t i = 0; i < 1000; i++)
+    {
+        uint32_t compare = 1 + (i % (load - 1));
+
+        {
+            ScopedProfile profile(0);
+            updatedPwm.setDuty(compare);
+        }
+
+        {
+            ScopedProfile profile(1);
+            updatedPwm.setCompare(compare, compare);
+        }
+
+        {
+            ScopedProfile profile(2);
+            updatedPwm.setPeriod(load);
+        }
+
+        {
+            ScopedProfile profile(3);
+            updatedPwm.setDutyQ16((i * 65) & 0xFFFF);
+        }
+    }
+}
+
+/**
+ * @brief Measures the cycles of a space vector and of a sine update of 
+ *        three phases at 20 kHz, angle and amplitude to committed compare 
+ *        values.
+ */
+void benchmarkSpaceVectorPwm(void)
+{
+    Profiler::nameSlot(0, "space vector update");
+    Profiler::nameSlot(1, "sine update");
+
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        phasePwm[i].initializeFrequency(2 * i, module0, 20000, 32768, countDirectionPwm::upAndDown);
+    }
+
+    uint32_t period = phasePwm[0].getResolution() / 2;
+
+    for(uint32_t mode = 0; mode < 2; mode++)
+    {
+        inverter.initialize(module0, pwmGen0, pwmGen1, pwmGen2, period, (mode == 0) ? pwmModulation::spaceVector : pwmModulation::sine);
+
+        for(uint32_t i = 0; i < 1000; i++)
+        {
+            ScopedProfile profile(mode);
+            inverter.setVoltagePolar((uint16_t)(i * 97), 29491);
+        }
+    }
+}
@@ -0,0 +1,256 @@
+/**
+ * @file streamBenchmark.cpp
+ * @brief µDMA Stream Benchmark
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "benchmarks.h"
+#include "../pwm/pwmStream.h"
+#include "../pwm/spaceVectorPwm.h"
+#include "../timer/timerPeriod.h"
+
+static const uint32_t sampleRate = 48000;
+static const uint32_t itemsPerHalf = 128;
+
+static const uint32_t captureRate = 1000000;
+static const uint32_t captureItemsPerHalf = 256;
+static const uint32_t captureSeconds = 60;
+static const uint32_t samplePeriod = 80; // cycles at 80 MHz and 1 MHz
+static const uint32_t lateLimit = samplePeriod + (samplePeriod/2); // cycles between two samples before one counts as dropped
+
+static const uint32_t timer1Base = 0x40031000;
+static const uint32_t timer2Base = 0x40032000;
+static const uint32_t timer3Base = 0x40033000;
+static const uint32_t timer4Base = 0x40034000;
+static const uint32_t GPTMCTL_OFFSET = 0x00C; // 0x00C GPTMCTL RW 0x0000.0000 GPTM Control 737
+static const uint32_t GPTMTAV_OFFSET = 0x050; // 0x050 GPTMTAV RW 0xFFFF.FFFF GPTM Timer A Value 766
+
+static Pwm speakerPwm;
+static GeneralPurposeTimer sampleTimer;
+static GeneralPurposeTimer isrTimer;
+static Dma streamDma;
+static PwmStream audio;
+
+static GeneralPurposeTimer pacingTimer;
+static GeneralPurposeTimer clockTimer;
+static Dma captureDma;
+
+static uint32_t waveform[256];
+static volatile uint32_t timestamps[2 * captureItemsPerHalf];
+static uint32_t lastTimestamp;
+static uint32_t expectedHalf;
+static volatile uint32_t halvesChecked;
+static volatile uint32_t samples[2 * itemsPerHalf];
+static uint32_t phase = 0;
+
+/**
+ * @brief Fixed amount of work, its cycles grow with the CPU time taken by
+ *        interrupts.
+ */
+static void busyWork(void)
+{
+    for(volatile uint32_t i = 0; i < 10000; i++)
+    {
+
+    }
+}
+
+/**
+ * @brief Measures \c busyWork 100 times into a slot.
+ */
+static void measureBusyWork(uint32_t slot)
+{
+    for(uint32_t i = 0; i < 100; i++)
+    {
+        ScopedProfile profile(slot);
+        busyWork();
+    }
+}
+
+/**
+ * @brief Stops a timer, the driver has no call for it.
+ */
+static void stopTimer(uint32_t timerBase)
+{
+    (*((volatile uint32_t*)(timerBase + GPTMCTL_OFFSET))) &= ~0x1;
+}
+
+/**
+ * @brief Refill callback of the stream, the next sample of the waveform for
+ *        every item of the free half.
+ */
+static void refillSamples(void* context, uint32_t half)
+{
+    (void)context;
+    volatile uint32_t* free = &samples[half * itemsPerHalf];
+
+    for(uint32_t i = 0; i < itemsPerHalf; i++)
+    {
+        free[i] = waveform[phase & 0xFF];
+        phase++;
+    }
+}
+
+/**
+ * @brief Timer interrupt callback of the interrupt per sample approach, the
+ *        same sample written with \c Pwm::setDuty.
+ */
+static void writeSample(void* context)
+{
+    (*((Pwm*)context)).setDuty(waveform[phase & 0xFF]);
+    phase++;
+}
+
+/**
+ * @brief Measures the CPU load of 48 kHz PWM audio streamed by the µDMA 
+ *        against a timer interrupt per sample. The cycles of the same busy 
+ *        work are measured idle, while streaming and while taking the 
+ *        sample interrupts; the load is 1 - idle/loaded.
+ */
+void benchmarkPwmStream(void)
+{
+    Profiler::nameSlot(0, "busy work idle");
+    Profiler::nameSlot(1, "busy work, dma stream 48k");
+    Profiler::nameSlot(2, "busy work, interrupt per sample 48k");
+
+    speakerPwm.initializeFrequency(7, module1, 4 * sampleRate, 32768, countDirectionPwm::down);
+    uint32_t load = speakerPwm.getResolution() - 1;
+
+    for(uint32_t i = 0; i < 256; i++)
+    {
+        waveform[i] = Pwm::compareFor(load, countDirectionPwm::down, (uint32_t)(32768 + SpaceVectorPwm::sine((uint16_t)(i << 8))));
+    }
+
+    measureBusyWork(0);
+
+    //1. Streamed by the µDMA, one interrupt per half
+    sampleTimer.initializeForPolling(periodic, shortTimer1, TimerFrequency<_80MHz, sampleRate, shortTimer1, timerA>::clockCycles, down, timerA, nullptr);
+
+    if(audio.initialize(&speakerPwm, &sampleTimer, &streamDma, 2))
+    {
+        refillSamples(nullptr, 0);
+        refillSamples(nullptr, 1);
+        audio.start(samples, itemsPerHalf, refillSamples, nullptr);
+        sampleTimer.enableTimer();
+
+        measureBusyWork(1);
+
+        stopTimer(timer1Base);
+        audio.stop();
+    }
+
+    //2. One timer interrupt per sample
+    isrTimer.initializeForInterupt(periodic, shortTimer2, TimerFrequency<_80MHz, sampleRate, shortTimer2, timerA>::clockCycles, down, timerA, positiveEdge, 2, writeSample, &speakerPwm);
+    isrTimer.enableTimer();
+
+    measureBusyWork(2);
+
+    stopTimer(timer2Base);
+}
+
+/**
+ * @brief Ping-pong callback of the capture, checks every timestamp of the
+ *        completed half against the one before it. A gap of more than 
+ *        \c lateLimit cycles is a dropped or late sample and is recorded 
+ *        to slot 1 with its length, a half out of order to slot 2.
+ */
+static void checkHalf(void* context, uint32_t half)
+{
+    (void)context;
+    ScopedProfile profile(0);
+
+    if(half != expectedHalf)
+    {
+        Profiler::record(2, half);
+    }
+
+    expectedHalf = half ^ 1;
+    volatile uint32_t* completed = &timestamps[half * captureItemsPerHalf];
+
+    for(uint32_t i = 0; i < captureItemsPerHalf; i++)
+    {
+        //The clock timer counts down
+        uint32_t gap = lastTimestamp - completed[i];
+
+        if(((halvesChecked != 0) || (i != 0)) && (gap > lateLimit))
+        {
+            Profiler::record(1, gap);
+        }
+
+        lastTimestamp = completed[i];
+    }
+
+    halvesChecked = halvesChecked + 1;
+}
+
+/**
+ * @brief Streams with the ping-pong mode at 1 MHz, the highest sample rate 
+ *        of the ADC, for \c captureSeconds and checks that no sample is 
+ *        dropped. A timer paced channel copies the value of a free running 
+ *        timer into the two halves, so every sample is the time of its 
+ *        request and a missed request shows as a gap. Slot 0 counts the halves and the cycles to check each, slot 1
+ *        the dropped samples, slot 2 the halves out of order and slot 3 a 
+ *        stall of the channel, a structure that was not re-armed in time.
+ */
+void benchmarkPingPong(void)
+{
+    Profiler::nameSlot(0, "ping-pong half checked");
+    Profiler::nameSlot(1, "ping-pong sample dropped, gap");
+    Profiler::nameSlot(2, "ping-pong half out of order");
+    Profiler::nameSlot(3, "ping-pong channel stalled");
+
+    clockTimer.initializeForPolling(periodic, shortTimer4, 0xFFFFFFFF, down, concatenated, nullptr);
+    pacingTimer.initializeForPolling(periodic, shortTimer3, TimerFrequency<_80MHz, captureRate, shortTimer3, timerA>::clockCycles, down, timerA, nullptr);
+
+    if(!pacingTimer.attachDma(&captureDma))
+    {
+        return;
+    }
+
+    pacingTimer.enableDmaInterrupt(1, Dma::pingPongComplete, &captureDma);
+    clockTimer.enableTimer();
+
+    halvesChecked = 0;
+    expectedHalf = 0;
+    volatile uint32_t* clock = (volatile uint32_t*)(timer4Base + GPTMTAV_OFFSET);
+
+    captureDma.startPingPong(clock, clock, dmaIncrement::none, &timestamps[0], &timestamps[captureItemsPerHalf], dmaIncrement::_32Bit, dmaDataSize::_32Bit, captureItemsPerHalf, dmaArbitrationSize::_1, checkHalf, nullptr);
+    pacingTimer.enableTimer();
+
+    while(halvesChecked < ((captureSeconds * captureRate) / captureItemsPerHalf))
+    {
+        if(!captureDma.isEnabled())
+        {
+            Profiler::record(3, 0);
+            break;
+        }
+    }
+
+    stopTimer(timer3Base);
+    stopTimer(timer4Base);
+    captureDma.disable();
+    captureDma.release();
+}
@@ -0,0 +1,95 @@
+/**
+ * @file timerBenchmark.cpp
+ * @brief General Purpose Timer Benchmark
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "benchmarks.h"
+#include "../timer/generalPurposeTimer.h"
+
+static const uint32_t timer0Base = 0x40030000;
+static const uint32_t GPTMMIS_OFFSET = 0x020; // 0x020 GPTMMIS RO 0x0000.0000 GPTM Masked Interrupt Status 751
+static const uint32_t GPTMICR_OFFSET = 0x024; // 0x024 GPTMICR W1C 0x0000.0000 GPTM Interrupt Clear 754
+
+static GeneralPurposeTimer timer;
+static volatile uint32_t callbackCount = 0;
+
+static void countTimeout(void* context)
+{
+    (*((volatile uint32_t*)context))++;
+}
+
+/**
+ * @brief Starts the one-shot timer and waits for its timeout, with the
+ *        interrupt pending but not taken.
+ */
+static void waitForTimeout(GeneralPurposeTimer* timer)
+{
+    (*timer).enableTimer();
+
+    while(((*((volatile uint32_t*)(timer0Base + GPTMMIS_OFFSET))) & 0x1) == 0)
+    {
+        //Wait
+    }
+}
+
+/**
+ * @brief Measures the body of the driver owned timer handler, 
+ *        \c GeneralPurposeTimer::dispatch with a callback, against a hand
+ *        written handler that clears the status and does the same work.
+ *        Interrupts are disabled and the handlers are called from thread 
+ *        mode after each timeout, so the exception entry and exit, the same
+ *        for both, are left out.
+ */
+void benchmarkTimerDispatch(void)
+{
+    Profiler::nameSlot(0, "timer dispatch");
+    Profiler::nameSlot(1, "hand written timer handler");
+
+    Nvic::disableInterrupts();
+    timer.initializeForInterupt(oneShot, shortTimer0, 800, down, timerA, positiveEdge, 7, countTimeout, (void*)&callbackCount);
+
+    for(uint32_t i = 0; i < 1000; i++)
+    {
+        waitForTimeout(&timer);
+
+        {
+            ScopedProfile profile(0);
+            GeneralPurposeTimer::dispatch(shortTimer0, timerA);
+        }
+
+        waitForTimeout(&timer);
+
+        {
+            ScopedProfile profile(1);
+            uint32_t firedStatus = (*((volatile uint32_t*)(timer0Base + GPTMMIS_OFFSET))) & 0x1F;
+            (*((volatile uint32_t*)(timer0Base + GPTMICR_OFFSET))) = firedStatus;
+            countTimeout((void*)&callbackCount);
+        }
+    }
+
+    Nvic::enableInterrupts();
+}
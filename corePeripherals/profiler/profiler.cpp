@@ -0,0 +1,235 @@
+/**
+ * @file profiler.cpp
+ * @brief TM4C123GH6PM Cycle Profiler Definition
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "profiler.h"
+
+#ifdef PROFILER_SEMIHOSTING
+#include <cstdio>
+
+extern "C" void initialise_monitor_handles(void);
+
+bool Profiler::handlesOpened = false;
+#endif
+
+const char* Profiler::slotName[numberOfSlots];
+uint32_t Profiler::slotCount[numberOfSlots];
+uint32_t Profiler::slotMinimum[numberOfSlots];
+uint32_t Profiler::slotMaximum[numberOfSlots];
+uint64_t Profiler::slotTotal[numberOfSlots];
+uint32_t Profiler::overhead = 0;
+
+/**
+ * @brief empty constructor placeholder
+ */
+Profiler::Profiler()
+{
+
+}
+
+/**
+ * @brief empty deconstructor placeholder
+ */
+Profiler::~Profiler()
+{
+
+}
+
+/**
+ * @brief Enables trace, the DWT cycle counter and the ITM, then measures the
+ *        overhead of reading the cycle counter.
+ */
+void Profiler::initialize(void)
+{
+    //1. Enable the DWT and ITM, TRCENA
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(corePeripheralBase + DEMCR_OFFSET)), (uint32_t)setORClear::set, 24, 1, RW);
+
+    //2. Unlock, reset and enable the cycle counter, CYCCNTENA
+    (*((volatile uint32_t*)(dwtBase + DWT_LAR_OFFSET))) = unlockKey;
+    (*((volatile uint32_t*)(dwtBase + DWT_CYCCNT_OFFSET))) = 0;
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(dwtBase + DWT_CTRL_OFFSET)), (uint32_t)setORClear::set, 0, 1, RW);
+
+    //3. Unlock and enable the ITM, ITMENA, with stimulus port 0
+    (*((volatile uint32_t*)(itmBase + ITM_LAR_OFFSET))) = unlockKey;
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(itmBase + ITM_TCR_OFFSET)), (uint32_t)setORClear::set, 0, 1, RW);
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(itmBase + ITM_TER_OFFSET)), (uint32_t)setORClear::set, 0, 1, RW);
+
+    //4. Cycles taken by two back to back reads of the counter
+    uint32_t start = cycles();
+    overhead = cycles() - start;
+
+    reset();
+
+#ifdef PROFILER_SEMIHOSTING
+    //5. Open the semihosting handles of the report once
+    if(handlesOpened == false)
+    {
+        initialise_monitor_handles();
+        handlesOpened = true;
+    }
+#endif
+}
+
+/**
+ * @brief Gives a slot a name that is printed in the report.
+ * 
+ * @param slot to be named
+ * @param name of the slot, has to stay valid while the slot is used
+ */
+void Profiler::nameSlot(uint32_t slot, const char* name)
+{
+    if(slot >= numberOfSlots)
+    {
+        return;
+    }
+
+    slotName[slot] = name;
+}
+
+/**
+ * @brief Records a measurement to a slot, less the overhead of reading the
+ *        cycle counter.
+ * 
+ * @param slot the measurement is recorded to
+ * @param elapsedCycles measured with \c cycles
+ */
+void Profiler::record(uint32_t slot, uint32_t elapsedCycles)
+{
+    if(slot >= numberOfSlots)
+    {
+        return;
+    }
+
+    elapsedCycles = ((elapsedCycles > overhead) ? (elapsedCycles - overhead) : 0);
+
+    if((slotCount[slot] == 0) || (elapsedCycles < slotMinimum[slot]))
+    {
+        slotMinimum[slot] = elapsedCycles;
+    }
+
+    if(elapsedCycles > slotMaximum[slot])
+    {
+        slotMaximum[slot] = elapsedCycles;
+    }
+
+    slotCount[slot] = slotCount[slot] + 1;
+    slotTotal[slot] = slotTotal[slot] + elapsedCycles;
+}
+
+/**
+ * @brief Clears the measurements of every slot. The slot names are kept.
+ */
+void Profiler::reset(void)
+{
+    for(uint32_t i = 0; i < numberOfSlots; i++)
+    {
+        slotCount[i] = 0;
+        slotMinimum[i] = 0;
+        slotMaximum[i] = 0;
+        slotTotal[i] = 0;
+    }
+}
+
+/**
+ * @brief Prints the count, minimum, maximum, total and mean cycles of every
+ *        used slot over semihosting. Only built with PROFILER_SEMIHOSTING
+ *        defined, a debugger then has to be attached. Otherwise it does 
+ *        nothing and the slots are read with the getters.
+ */
+void Profiler::report(void)
+{
+#ifdef PROFILER_SEMIHOSTING
+    printf("slot name count min max total mean\n");
+
+    for(uint32_t i = 0; i < numberOfSlots; i++)
+    {
+        if(slotCount[i] != 0)
+        {
+            printf("%lu %s %lu %lu %lu ", (unsigned long)i, ((slotName[i] != nullptr) ? slotName[i] : "-"), (unsigned long)slotCount[i], 
+                (unsigned long)slotMinimum[i], (unsigned long)slotMaximum[i]);
+
+            //newlib-nano printf has no long long support, the total is printed in two parts
+            if((slotTotal[i]/1000000000) != 0)
+            {
+                printf("%lu%09lu ", (unsigned long)(slotTotal[i]/1000000000), (unsigned long)(slotTotal[i]%1000000000));
+            }
+
+            else
+            {
+                printf("%lu ", (unsigned long)slotTotal[i]);
+            }
+
+            printf("%lu\n", (unsigned long)(slotTotal[i]/slotCount[i]));
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Gets the number of measurements recorded to a slot.
+ * 
+ * @param slot to be read
+ * @return number of measurements
+ */
+uint32_t Profiler::getCount(uint32_t slot)
+{
+    return((slot < numberOfSlots) ? slotCount[slot] : 0);
+}
+
+/**
+ * @brief Gets the smallest measurement recorded to a slot.
+ * 
+ * @param slot to be read
+ * @return minimum in cycles
+ */
+uint32_t Profiler::getMinimum(uint32_t slot)
+{
+    return((slot < numberOfSlots) ? slotMinimum[slot] : 0);
+}
+
+/**
+ * @brief Gets the largest measurement recorded to a slot.
+ * 
+ * @param slot to be read
+ * @return maximum in cycles
+ */
+uint32_t Profiler::getMaximum(uint32_t slot)
+{
+    return((slot < numberOfSlots) ? slotMaximum[slot] : 0);
+}
+
+/**
+ * @brief Gets the sum of the measurements recorded to a slot.
+ * 
+ * @param slot to be read
+ * @return total in cycles
+ */
+uint64_t Profiler::getTotal(uint32_t slot)
+{
+    return((slot < numberOfSlots) ? slotTotal[slot] : 0);
+}
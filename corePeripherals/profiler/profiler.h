@@ -0,0 +1,138 @@
+/**
+ * @file profiler.h
+ * @brief TM4C123GH6PM Cycle Profiler Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class Profiler
+ * @brief TM4C123GH6PM Cycle Profiler
+ * 
+ * @section profilerDescription Profiler Description
+ * 
+ * The Profiler measures code in core clock cycles using the cycle counter
+ * (CYCCNT) of the Data Watchpoint and Trace unit (DWT). \c initialize enables
+ * trace (TRCENA), the cycle counter and the Instrumentation Trace Macrocell
+ * (ITM). \c cycles reads the free running 32-bit cycle counter and is inlined,
+ * so the difference of two reads is the cycle count of the code in between,
+ * correct across a single wrap of the counter.
+ * 
+ * Measurements are accumulated in a fixed number of static slots. Each slot 
+ * keeps the count, minimum, maximum and total of the cycles recorded to it 
+ * and can be given a name with \c nameSlot. The overhead of reading the 
+ * counter is measured during initialization and subtracted from every
+ * measurement. \c ScopedProfile records the cycles of a scope to a slot. 
+ * Built with PROFILER_SEMIHOSTING defined, from 
+ * \c make PROFILER_DEFS=-DPROFILER_SEMIHOSTING, \c report prints every used
+ * slot over semihosting and a debugger has to be attached. Otherwise 
+ * \c report does nothing, so the program runs without a debugger, and the 
+ * slots are read with the getters.
+ * 
+ * @code
+ * Profiler::initialize();
+ * Profiler::nameSlot(0, "adc read");
+ * {
+ *     ScopedProfile profile(0);
+ *     myAdc.read();
+ * }
+ * Profiler::report();
+ * @endcode
+ * 
+ * For more detailed information on the DWT and ITM please see the ARMv7-M 
+ * Architecture Reference Manual.
+ * 
+ * @subsection profilerRegisterDescription Profiler Register Description
+ * 
+ * The Profiler class contains a list of DEMCR, DWT and ITM registers listed as
+ * an offset relative to the hexadecimal base address of Core Peripherals 
+ * 0xE000E000, the DWT 0xE0001000 and the ITM 0xE0000000.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "../../register/register.h"
+
+class Profiler
+{
+    public:
+        Profiler();
+        ~Profiler();
+
+        static void initialize(void);
+
+        /**
+         * @brief Reads the DWT cycle counter.
+         * 
+         * @return current core clock cycle count
+         */
+        static inline uint32_t cycles(void)
+        {
+            return(*((volatile uint32_t*)(dwtBase + DWT_CYCCNT_OFFSET)));
+        }
+
+        static void nameSlot(uint32_t slot, const char* name);
+        static void record(uint32_t slot, uint32_t elapsedCycles);
+        static void reset(void);
+        static void report(void);
+
+        static uint32_t getCount(uint32_t slot);
+        static uint32_t getMinimum(uint32_t slot);
+        static uint32_t getMaximum(uint32_t slot);
+        static uint64_t getTotal(uint32_t slot);
+
+        static const uint32_t numberOfSlots = 16;
+
+    private:
+
+        static const char* slotName[numberOfSlots];
+        static uint32_t slotCount[numberOfSlots];
+        static uint32_t slotMinimum[numberOfSlots];
+        static uint32_t slotMaximum[numberOfSlots];
+        static uint64_t slotTotal[numberOfSlots];
+        static uint32_t overhead;
+
+#ifdef PROFILER_SEMIHOSTING
+        static bool handlesOpened;
+#endif
+
+        static const uint32_t dwtBase = 0xE0001000;
+        static const uint32_t itmBase = 0xE0000000;
+
+        static const uint32_t DEMCR_OFFSET = 0xDFC; // 0xDFC DEMCR RW 0x0000.0000 Debug Exception and Monitor Control
+
+        static const uint32_t DWT_CTRL_OFFSET = 0x000; // 0x000 DWT_CTRL RW 0x4000.0000 DWT Control
+        static const uint32_t DWT_CYCCNT_OFFSET = 0x004; // 0x004 DWT_CYCCNT RW 0x0000.0000 DWT Cycle Count
+        static const uint32_t DWT_LAR_OFFSET = 0xFB0; // 0xFB0 DWT_LAR WO - DWT Lock Access
+
+        static const uint32_t ITM_TER_OFFSET = 0xE00; // 0xE00 ITM_TER RW 0x0000.0000 ITM Trace Enable
+        static const uint32_t ITM_TCR_OFFSET = 0xE80; // 0xE80 ITM_TCR RW 0x0000.0000 ITM Trace Control
+        static const uint32_t ITM_LAR_OFFSET = 0xFB0; // 0xFB0 ITM_LAR WO - ITM Lock Access
+
+        static const uint32_t unlockKey = 0xC5ACCE55; // CoreSight lock access key
+};
+
+#endif //PROFILER_H
@@ -0,0 +1,77 @@
+/**
+ * @file scopedProfile.h
+ * @brief TM4C123GH6PM Scoped Cycle Profile Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class ScopedProfile
+ * @brief Records the cycles spent in a scope to a Profiler slot.
+ * 
+ * @section scopedProfileDescription Scoped Profile Description
+ * 
+ * The cycle counter is read when the ScopedProfile is constructed and again
+ * when it goes out of scope, the difference is recorded to the slot. Both
+ * reads are inlined so the measurement adds only a few cycles.
+ */
+
+#ifndef SCOPED_PROFILE_H
+#define SCOPED_PROFILE_H
+
+#include "profiler.h"
+
+class ScopedProfile
+{
+    public:
+
+        /**
+         * @brief Starts measuring the scope.
+         * 
+         * @param slot of the Profiler the cycles are recorded to
+         */
+        ScopedProfile(uint32_t slot) : slot(slot), start(Profiler::cycles())
+        {
+
+        }
+
+        /**
+         * @brief Records the cycles since construction to the slot.
+         */
+        ~ScopedProfile()
+        {
+            Profiler::record(slot, Profiler::cycles() - start);
+        }
+
+    private:
+
+        ScopedProfile(const ScopedProfile&);
+        ScopedProfile& operator=(const ScopedProfile&);
+
+        uint32_t slot;
+        uint32_t start;
+};
+
+#endif //SCOPED_PROFILE_H
@@ -29,6 +29,18 @@
 
 #include "pwm.h"
 
+bool Pwm::moduleInitialized[2] = {false, false};
+uint32_t Pwm::pwmDivisorShift = Pwm::divisorUnset;
+bool Pwm::divisorConflict = false;
+void (*Pwm::faultCallback[2][4])(void*) = {};
+void* Pwm::faultContext[2][4] = {};
+void (*Pwm::generatorCallback[2][4])(void*) = {};
+void* Pwm::generatorContext[2][4] = {};
+uint32_t Pwm::interruptPrescale[2][4] = {};
+uint32_t Pwm::prescaleCount[2][4] = {};
+
+constexpr interrupt Pwm::generatorInterrupt[2][4];
+
 /**
  * @brief empty constructor placeholder
  */
@@ -82,6 +94,7 @@ Pwm::~Pwm()
 void Pwm::initializeSingle(uint32_t pwmPin, pwmModule module, uint32_t period, uint32_t compA, uint32_t compB, countDirectionPwm countDir, uint32_t genOptions, bool enablePwmDiv, uint32_t divisor)
 {
     myPwmGen = pwmPin/2;
+    myPwmPin = pwmPin;
     
     initialize(module, period, countDir, enablePwmDiv, divisor);
     
@@ -94,6 +107,9 @@ void Pwm::initializeSingle(uint32_t pwmPin, pwmModule module, uint32_t period, u
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CMPA_OFFSET + (0x40 * myPwmGen))), compA, 0, 15+1, RW);
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CMPB_OFFSET + (0x40 * myPwmGen))), compB, 0, 15+1, RW);
 
+    //5. Locally synchronized updates (LOADUPD, CMPAUPD and CMPBUPD clear), new load and comparator values are latched when the counter reaches 0
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), 0x0, 3, 3, RW);
+
     //6. Enable PWM
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), (uint32_t)setORClear::set, 0, 1, RW);
 
@@ -147,6 +163,7 @@ void Pwm::initializeSingle(uint32_t pwmPin, pwmModule module, uint32_t period, u
 void Pwm::initializePair(uint32_t pwmPin, pwmModule module, uint32_t period, uint32_t compA, uint32_t compB, countDirectionPwm countDir, uint32_t genOptionsA, uint32_t genOptionsB, bool enablePwmDiv, uint32_t divisor)
 {
     myPwmGen = pwmPin/2;
+    myPwmPin = pwmPin;
 
     initialize(module, period, countDir, enablePwmDiv, divisor);
     
@@ -164,11 +181,59 @@ void Pwm::initializePair(uint32_t pwmPin, pwmModule module, uint32_t period, uin
     //5. Set counter comparator for pwmB
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CMPB_OFFSET + (0x40 * myPwmGen))), compB, 0, 15+1, RW);
 
+    //5b. Locally synchronized updates (LOADUPD, CMPAUPD and CMPBUPD clear), new load and comparator values are latched when the counter reaches 0
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), 0x0, 3, 3, RW);
+
     //6. Enable PWM
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), (uint32_t)setORClear::set, 0, 1, RW);
 
     //7. Enable PWM output.
-    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWMENABLE_OFFSET + (0x40 * myPwmGen))), 0x3, pwmPin, 2, RW); 
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + PWMENABLE_OFFSET), 0x3, pwmPin, 2, RW);
+}
+
+/**
+ * @brief Init single ended PWM from a frequency and a duty cycle. The PWM 
+ *        clock divisor is the smallest one that fits the period in the 
+ *        counter, or the one already in use by other generators. The output
+ *        goes high at the start of the period and low after the duty cycle,
+ *        centered around the load value in up/down mode.
+ * 
+ * @param pwmPin Output pin of the PWM module.
+ * @param module to which the \c pwmPin belongs.
+ * @param hertz frequency of the PWM
+ * @param dutyQ16 duty cycle, 65536 is 100%
+ * @param countDir Direction to count, down or up and down for center aligned
+ *                 outputs.
+ * @return false if the frequency can not be reached, with the divisor in use
+ *         by other generators if there is one. The generator is left 
+ *         untouched.
+ */
+bool Pwm::initializeFrequency(uint32_t pwmPin, pwmModule module, uint32_t hertz, uint32_t dutyQ16, countDirectionPwm countDir)
+{
+    uint32_t clockHertz = SystemControl::getClockFrequency();
+
+    if((hertz == 0) || (hertz > clockHertz))
+    {
+        return(false);
+    }
+
+    uint32_t shift = (pwmDivisorShift == divisorUnset) ? divisorShiftFor(clockHertz, hertz, countDir) : pwmDivisorShift;
+    uint32_t load = loadFor(clockHertz, hertz, countDir, shift);
+
+    if((load < 2) || (load > 0xFFFF))
+    {
+        divisorConflict = divisorConflict || (pwmDivisorShift != divisorUnset);
+        return(false);
+    }
+
+    uint32_t compare = compareFor(load, countDir, dutyQ16);
+
+    initializeSingle(pwmPin, module, load, compare, compare, countDir, genOptionsFor(pwmPin, countDir, dutyQ16), (shift != 0), (shift != 0) ? (shift - 1) : 0);
+
+    //Locally synchronized generator updates (GENAUPD or GENBUPD 0x2), setDutyQ16 switches to and from 0% and 100% when the counter reaches 0
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 0x2, 6 + ((pwmPin%2) * 2), 2, RW);
+
+    return(true);
 }
 
 /**
@@ -184,7 +249,9 @@ void Pwm::initializePair(uint32_t pwmPin, pwmModule module, uint32_t period, uin
  */
 void Pwm::initialize(pwmModule module, uint32_t period, countDirectionPwm countDir, bool enablePwmDiv, uint32_t divisor)
 {    
+    myModule = module;
     baseAddress = pwm0BaseAddress + (module * 0x1000);
+    generatorAddress = baseAddress + (0x40 * myPwmGen);
     
     //0. Enable the clock for PWM
     Register::setRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + RCGCPWM_OFFSET)), (uint32_t)setORClear::set, module, 1, RW);
@@ -193,28 +260,51 @@ void Pwm::initialize(pwmModule module, uint32_t period, countDirectionPwm countD
         //Ready??
     }
 
-    // Clear count register by reseting PWM
+    // Clear count register by reseting PWM, only on first use so generators initialized before are kept
+    if(moduleInitialized[module] == false)
+    {
+        Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + SRPWM_OFFSET), (uint32_t)setORClear::set, module, 1, RW);
+
+        for(uint32_t i = 0; i < 100; i++)
+        {
+            //wait
+        }
 
-    Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + SRPWM_OFFSET), (uint32_t)setORClear::set, module, 1, RW);
+        Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + SRPWM_OFFSET), (uint32_t)setORClear::clear, module, 1, RW);
 
-    for(uint32_t i = 0; i < 100; i++)
-    {
-        //wait
+        while(Register::getRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + PRPWM_OFFSET), module, 1, RO) == 0)
+        {
+            //Ready??
+        }
+
+        moduleInitialized[module] = true;
     }
 
-    Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + SRPWM_OFFSET), (uint32_t)setORClear::clear, module, 1, RW);
+    /*
+     * The PWM clock divisor in RCC is shared by every generator of both 
+     * modules. The first generator sets it, a later generator asking for a
+     * different divisor would change the frequency of the ones running, so
+     * the divisor is kept and the conflict recorded.
+     */
+    uint32_t requestedShift = (enablePwmDiv == true) ? (divisor + 1) : 0;
 
-    while(Register::getRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + PRPWM_OFFSET), module, 1, RO) == 0)
+    if(pwmDivisorShift == divisorUnset)
     {
-        //Ready??
+        //1a. Configure the Run-Mode Clock Configuration (RCC) register in the System Control module to use the PWM divide (USEPWMDIV).
+        Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + RCC_OFFSET), (enablePwmDiv == true) ? (uint32_t)setORClear::set : (uint32_t)setORClear::clear, 20, 1, RW);
+
+        if(enablePwmDiv == true)
+        {
+            //1b. Set the divider (PWMDIV).
+            Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + RCC_OFFSET), divisor, 17, (19-17)+1, RW);
+        }
+
+        pwmDivisorShift = requestedShift;
     }
 
-    if(enablePwmDiv == true)
+    else if(pwmDivisorShift != requestedShift)
     {
-        //1a. Configure the Run-Mode Clock Configuration (RCC) register in the System Control module to use the PWM divide (USEPWMDIV).
-        Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + RCC_OFFSET), (uint32_t)setORClear::set, 20, 1, RW);
-        //1b. Set the divider (PWMDIV).
-        Register::setRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + RCC_OFFSET), divisor, 17, (19-17)+1, RW);
+        divisorConflict = true;
     }
 
     //2. Configure the PWM generator for countdown mode with immediate updates to the parameters.
@@ -223,9 +313,589 @@ void Pwm::initialize(pwmModule module, uint32_t period, countDirectionPwm countD
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), (uint32_t)setORClear::clear, 0, 1, RW);
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), (uint32_t)setORClear::set, 2, 1, RW);
 
-    //Set count direction
-    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), (uint32_t)countDir, 3, 1, RW);
+    //Set count direction, MODE
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0CTL_OFFSET + (0x40 * myPwmGen))), (uint32_t)countDir, 1, 1, RW);
 
     //3. Set the period
     Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (PWM0LOAD_OFFSET + (0x40 * myPwmGen))), period, 0, 15+1, RW);
 }
+
+/**
+ * @brief Sets the comparator of the PWM pin, comparator A for an even pin and
+ *        comparator B for an odd pin. The duty cycle this gives depends on the
+ *        generator options.
+ * 
+ * @details A single store to the comparator. The new value is latched when 
+ *          the counter reaches 0 so the output never glitches, safe to call
+ *          from a control loop interrupt.
+ * 
+ * @param compare new comparator value in clock ticks, less than the period
+ */
+void Pwm::setDuty(uint32_t compare)
+{
+    (*((volatile uint32_t*)(generatorAddress + (((myPwmPin%2) == 0) ? PWM0CMPA_OFFSET : PWM0CMPB_OFFSET)))) = compare;
+}
+
+/**
+ * @brief Sets the duty cycle of a PWM pin initialized with 
+ *        \c initializeFrequency, latched when the counter reaches 0.
+ * 
+ * @details 0 and 65536 or more hold the output low or high for the whole 
+ *          period through the generator options, the generator register is
+ *          only written when entering or leaving those ends.
+ * 
+ * @param dutyQ16 duty cycle, 65536 is 100%
+ */
+void Pwm::setDutyQ16(uint32_t dutyQ16)
+{
+    uint32_t load = (*((volatile uint32_t*)(generatorAddress + PWM0LOAD_OFFSET))) & 0xFFFF;
+    countDirectionPwm countDir = (countDirectionPwm)Register::getRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 1, 1, RW);
+    volatile uint32_t* genAddress = (volatile uint32_t*)(generatorAddress + PWM0GENA_OFFSET + ((myPwmPin%2) * 4));
+    uint32_t genOptions = genOptionsFor(myPwmPin, countDir, dutyQ16);
+
+    if(((*genAddress) & 0xFFF) != genOptions)
+    {
+        (*genAddress) = genOptions;
+    }
+
+    setDuty(compareFor(load, countDir, dutyQ16));
+}
+
+/**
+ * @brief Sets the duty cycle of a PWM pin initialized with 
+ *        \c initializeFrequency, latched when the counter reaches 0.
+ * 
+ * @param percent duty cycle, 0 to 100
+ */
+void Pwm::setDutyPercent(uint32_t percent)
+{
+    setDutyQ16((percent * 65536)/100);
+}
+
+/**
+ * @brief Gets the frequency the generator runs at, from its load value and
+ *        the PWM clock.
+ * 
+ * @return frequency in Hz
+ */
+uint32_t Pwm::getFrequency(void)
+{
+    uint32_t load = (*((volatile uint32_t*)(generatorAddress + PWM0LOAD_OFFSET))) & 0xFFFF;
+    countDirectionPwm countDir = (countDirectionPwm)Register::getRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 1, 1, RW);
+
+    return(frequencyFor(getPwmClockFrequency(), load, countDir, 0));
+}
+
+/**
+ * @brief Gets the resolution of the duty cycle, the number of PWM clock 
+ *        ticks in a period.
+ * 
+ * @return steps of the duty cycle
+ */
+uint32_t Pwm::getResolution(void)
+{
+    uint32_t load = (*((volatile uint32_t*)(generatorAddress + PWM0LOAD_OFFSET))) & 0xFFFF;
+    countDirectionPwm countDir = (countDirectionPwm)Register::getRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 1, 1, RW);
+
+    return((countDir == countDirectionPwm::down) ? (load + 1) : (2 * load));
+}
+
+/**
+ * @brief Checks if a generator asked for a PWM clock divisor other than the
+ *        one already in use. The divisor is shared by every generator.
+ * 
+ * @return true if a conflict was detected
+ */
+bool Pwm::hasDivisorConflict(void)
+{
+    return(divisorConflict);
+}
+
+/**
+ * @brief Enables a set of outputs of a module with a single store to 
+ *        PWMENABLE, the other outputs are not changed.
+ * 
+ * @details PWMENABLE is read and written back with interrupts disabled, so
+ *          a change made by an interrupt in between is not overwritten. 
+ *          Interrupts are enabled again only if they were enabled before.
+ * 
+ * @param module of the outputs
+ * @param outputMask bit n set for output MnPWMn
+ */
+void Pwm::enableOutputs(pwmModule module, uint32_t outputMask)
+{
+    volatile uint32_t* pwmEnable = (volatile uint32_t*)(pwm0BaseAddress + (module * 0x1000) + PWMENABLE_OFFSET);
+    uint32_t primask = Nvic::disableInterrupts();
+
+    (*pwmEnable) = (*pwmEnable) | (outputMask & 0xFF);
+
+    if((primask & 0x1) == 0)
+    {
+        Nvic::enableInterrupts();
+    }
+}
+
+/**
+ * @brief Disables a set of outputs of a module with a single store to 
+ *        PWMENABLE, the other outputs are not changed. A disabled output is
+ *        driven low, or high when it is inverted.
+ * 
+ * @details PWMENABLE is read and written back with interrupts disabled, so
+ *          a change made by an interrupt in between is not overwritten. 
+ *          Interrupts are enabled again only if they were enabled before.
+ * 
+ * @param module of the outputs
+ * @param outputMask bit n set for output MnPWMn
+ */
+void Pwm::disableOutputs(pwmModule module, uint32_t outputMask)
+{
+    volatile uint32_t* pwmEnable = (volatile uint32_t*)(pwm0BaseAddress + (module * 0x1000) + PWMENABLE_OFFSET);
+    uint32_t primask = Nvic::disableInterrupts();
+
+    (*pwmEnable) = (*pwmEnable) & ~(outputMask & 0xFF);
+
+    if((primask & 0x1) == 0)
+    {
+        Nvic::enableInterrupts();
+    }
+}
+
+/**
+ * @brief Sets which of the eight outputs of a module are enabled with a 
+ *        single store to PWMENABLE.
+ * 
+ * @param module of the outputs
+ * @param enabledMask bit n set for output MnPWMn enabled, clear for disabled
+ */
+void Pwm::setOutputs(pwmModule module, uint32_t enabledMask)
+{
+    (*((volatile uint32_t*)(pwm0BaseAddress + (module * 0x1000) + PWMENABLE_OFFSET))) = enabledMask & 0xFF;
+}
+
+/**
+ * @brief Sets which of the eight outputs of a module are inverted with a 
+ *        single store to PWMINVERT. Takes effect immediately.
+ * 
+ * @param module of the outputs
+ * @param invertedMask bit n set for output MnPWMn inverted
+ */
+void Pwm::invertOutputs(pwmModule module, uint32_t invertedMask)
+{
+    (*((volatile uint32_t*)(pwm0BaseAddress + (module * 0x1000) + PWMINVERT_OFFSET))) = invertedMask & 0xFF;
+}
+
+/**
+ * @brief Selects when changes to PWMENABLE reach a set of outputs. Locally
+ *        synchronized changes wait for the counter of the generator of the
+ *        output to reach 0, globally synchronized changes also wait for a
+ *        global update requested through PWMCTL.
+ * 
+ * @param module of the outputs
+ * @param outputMask bit n set for output MnPWMn
+ * @param update mode of the outputs
+ */
+void Pwm::setEnableUpdate(pwmModule module, uint32_t outputMask, pwmEnableUpdate update)
+{
+    volatile uint32_t* enableUpdate = (volatile uint32_t*)(pwm0BaseAddress + (module * 0x1000) + PWMENUPD_OFFSET);
+    uint32_t value = (*enableUpdate);
+
+    for(uint32_t output = 0; output < 8; output++)
+    {
+        if((outputMask & (1 << output)) != 0)
+        {
+            value = (value & ~(0x3 << (output * 2))) | ((uint32_t)update << (output * 2));
+        }
+    }
+
+    (*enableUpdate) = value;
+}
+
+/**
+ * @brief Sets both comparators of the generator. Each is a single store 
+ *        latched when the counter reaches 0.
+ * 
+ * @param compA new comparator A value in clock ticks
+ * @param compB new comparator B value in clock ticks
+ */
+void Pwm::setCompare(uint32_t compA, uint32_t compB)
+{
+    (*((volatile uint32_t*)(generatorAddress + PWM0CMPA_OFFSET))) = compA;
+    (*((volatile uint32_t*)(generatorAddress + PWM0CMPB_OFFSET))) = compB;
+}
+
+/**
+ * @brief Sets comparator A of the generator with a single store latched when
+ *        the counter reaches 0.
+ * 
+ * @param compA new comparator A value in clock ticks
+ */
+void Pwm::setCompareA(uint32_t compA)
+{
+    (*((volatile uint32_t*)(generatorAddress + PWM0CMPA_OFFSET))) = compA;
+}
+
+/**
+ * @brief Sets comparator B of the generator with a single store latched when
+ *        the counter reaches 0.
+ * 
+ * @param compB new comparator B value in clock ticks
+ */
+void Pwm::setCompareB(uint32_t compB)
+{
+    (*((volatile uint32_t*)(generatorAddress + PWM0CMPB_OFFSET))) = compB;
+}
+
+/**
+ * @brief Sets the period of the generator with a single store to the load
+ *        register, latched when the counter reaches 0.
+ * 
+ * @param period new period in clock ticks, up to 16-bits
+ */
+void Pwm::setPeriod(uint32_t period)
+{
+    (*((volatile uint32_t*)(generatorAddress + PWM0LOAD_OFFSET))) = period;
+}
+
+/**
+ * @brief Enables the dead-band generator of the generator, or updates the
+ *        delays when it is already enabled. The dead-band generator builds
+ *        both outputs of the generator from \c pwmA, \c pwmB is delayed on
+ *        its rising edge and the inverted \c pwmB on its falling edge. 
+ * 
+ * @details The delays are converted to PWM clock ticks using the current 
+ *          system clock and PWM clock divisor and limited to 12-bits. Updates
+ *          are locally synchronized and latched when the counter reaches 0.
+ * 
+ * @param risingNanoseconds delay of the rising edge of \c pwmA
+ * @param fallingNanoseconds delay of the rising edge of the inverted 
+ *        \c pwmB, the falling edge of \c pwmA
+ */
+void Pwm::setDeadBand(uint32_t risingNanoseconds, uint32_t fallingNanoseconds)
+{
+    //1. Locally synchronized updates of the dead-band control, rising and falling delays
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 0x2, 10, 2, RW);
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 0x2, 12, 2, RW);
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), 0x2, 14, 2, RW);
+
+    //2. Rising and falling edge delays in PWM clock ticks
+    (*((volatile uint32_t*)(generatorAddress + PWM0DBRISE_OFFSET))) = nanosecondsToTicks(risingNanoseconds);
+    (*((volatile uint32_t*)(generatorAddress + PWM0DBFALL_OFFSET))) = nanosecondsToTicks(fallingNanoseconds);
+
+    //3. Enable the dead-band generator
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0DBCTL_OFFSET), (uint32_t)setORClear::set, 0, 1, RW);
+}
+
+/**
+ * @brief Disables the dead-band generator, the generator outputs pass 
+ *        through unmodified.
+ */
+void Pwm::disableDeadBand(void)
+{
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0DBCTL_OFFSET), (uint32_t)setORClear::clear, 0, 1, RW);
+}
+
+/**
+ * @brief Configures the fault sources of the generator. Once a fault is
+ *        asserted the outputs enabled with \c setFaultOutput are driven to
+ *        their fault level by hardware.
+ * 
+ * @param faultPins bit n set to use fault pin MnFAULTn, the TM4C123GH6PM
+ *        only has MnFAULT0
+ * @param digitalComparators bit n set to use ADC digital comparator n
+ * @param activeLowPins bit n set if fault pin n is active low
+ * @param latch true to hold the fault until \c clearFaultStatus is called
+ * @param minimumFaultPeriod minimum number of PWM clock ticks a fault is held
+ *        for, 0 to disable. Up to 16-bits.
+ */
+void Pwm::initializeFault(uint32_t faultPins, uint32_t digitalComparators, uint32_t activeLowPins, bool latch, uint32_t minimumFaultPeriod)
+{
+    //1. Fault sense of the pins
+    (*((volatile uint32_t*)(baseAddress + PWM0FLTSEN_OFFSET + (0x80 * myPwmGen)))) = activeLowPins & 0xF;
+
+    //2. Fault sources, pins and digital comparators
+    (*((volatile uint32_t*)(generatorAddress + PWM0FLTSRC0_OFFSET))) = faultPins & 0xF;
+    (*((volatile uint32_t*)(generatorAddress + PWM0FLTSRC1_OFFSET))) = digitalComparators & 0xFF;
+
+    //3. Minimum fault period, MINFLTPER
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0MINFLTPER_OFFSET), minimumFaultPeriod, 0, 16, RW);
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), ((minimumFaultPeriod != 0) ? 0x1 : 0x0), 17, 1, RW);
+
+    //4. Latched faults (LATCH) and fault condition from the fault source registers (FLTSRC)
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), (latch ? 0x1 : 0x0), 18, 1, RW);
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0CTL_OFFSET), (uint32_t)setORClear::set, 16, 1, RW);
+}
+
+/**
+ * @brief Sets the level the two outputs of the generator are driven to
+ *        during a fault and enables the fault handling of the outputs.
+ * 
+ * @param levelA of \c pwmA during a fault, true for high
+ * @param levelB of \c pwmB during a fault, true for high
+ */
+void Pwm::setFaultOutput(bool levelA, bool levelB)
+{
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + PWMFAULTVAL_OFFSET), ((levelB ? 0x2 : 0x0) | (levelA ? 0x1 : 0x0)), (myPwmGen*2), 2, RW);
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + PWMFAULT_OFFSET), 0x3, (myPwmGen*2), 2, RW);
+}
+
+/**
+ * @brief Gets the fault status of the generator. Latched when the fault was
+ *        initialized with latching.
+ * 
+ * @return fault pins in bits 3:0 and digital comparators in bits 15:8
+ */
+uint32_t Pwm::getFaultStatus(void)
+{
+    uint32_t pins = (*((volatile uint32_t*)(baseAddress + PWM0FLTSTAT0_OFFSET + (0x80 * myPwmGen)))) & 0xF;
+    uint32_t comparators = (*((volatile uint32_t*)(baseAddress + PWM0FLTSTAT1_OFFSET + (0x80 * myPwmGen)))) & 0xFF;
+
+    return((comparators << 8) | pins);
+}
+
+/**
+ * @brief Clears the latched fault status of the generator. The outputs 
+ *        resume once the fault source is no longer asserted.
+ */
+void Pwm::clearFaultStatus(void)
+{
+    (*((volatile uint32_t*)(baseAddress + PWM0FLTSTAT0_OFFSET + (0x80 * myPwmGen)))) = 0xF;
+    (*((volatile uint32_t*)(baseAddress + PWM0FLTSTAT1_OFFSET + (0x80 * myPwmGen)))) = 0xFF;
+}
+
+/**
+ * @brief Enables the fault interrupt of the generator. The driver owns the
+ *        fault vector of the module, it clears the fault interrupt and calls
+ *        the callback. The outputs are already shut down by hardware when the
+ *        callback runs.
+ * 
+ * @param priority of the interrupt. Lower numbers have higher priority.
+ * @param callback called from the interrupt, may be nullptr
+ * @param context passed to the callback
+ */
+void Pwm::enableFaultInterrupt(uint32_t priority, void (*callback)(void*), void* context)
+{
+    faultCallback[myModule][myPwmGen] = callback;
+    faultContext[myModule][myPwmGen] = context;
+
+    //INTFAULTn
+    (*((volatile uint32_t*)(baseAddress + PWMISC_OFFSET))) = (1 << (16 + myPwmGen));
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + PWMINTEN_OFFSET), (uint32_t)setORClear::set, 16 + myPwmGen, 1, RW);
+
+    Nvic::activateInterrupt(((myModule == module0) ? PWM_0_Fault_Interrupt : PWM_1_Fault_Interrupt), priority);
+}
+
+/**
+ * @brief Services the fault interrupt of a module. Clears the fault 
+ *        interrupts that fired and calls the callback of each generator.
+ *        Called from the PWM fault interrupt vectors.
+ * 
+ * @param module that interrupted
+ */
+void Pwm::dispatchFault(pwmModule module)
+{
+    uint32_t baseAddress = pwm0BaseAddress + (module * 0x1000);
+    uint32_t firedStatus = (*((volatile uint32_t*)(baseAddress + PWMISC_OFFSET))) & 0x000F0000;
+
+    (*((volatile uint32_t*)(baseAddress + PWMISC_OFFSET))) = firedStatus;
+
+    for(uint32_t generator = 0; generator < 4; generator++)
+    {
+        if(((firedStatus & (1 << (16 + generator))) != 0) && (faultCallback[module][generator] != nullptr))
+        {
+            faultCallback[module][generator](faultContext[module][generator]);
+        }
+    }
+}
+
+/**
+ * @brief Selects the counter events of the generator that trigger the ADC.
+ *        The ADC sample sequencer needs \c ssTriggerSource::pwmGenN of this 
+ *        generator and \c Adc::selectPwmTriggerModule for this module.
+ * 
+ * @param events or'd \c pwmEvent values, 0 disables the ADC trigger
+ */
+void Pwm::setAdcTrigger(uint32_t events)
+{
+    //TRCNTZERO, TRCNTLOAD, TRCMPAU, TRCMPAD, TRCMPBU, TRCMPBD
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0INTEN_OFFSET), events, 8, (13-8)+1, RW);
+}
+
+/**
+ * @brief Enables the interrupt of the generator on the selected counter
+ *        events. The driver owns the generator vector, it clears the 
+ *        interrupt and calls the callback every \c prescale interrupts.
+ * 
+ * @param events or'd \c pwmEvent values
+ * @param priority of the interrupt. Lower numbers have higher priority.
+ * @param callback called from the interrupt, may be nullptr
+ * @param context passed to the callback
+ * @param prescale number of interrupts per callback, 0 is treated as 1
+ */
+void Pwm::enableInterrupt(uint32_t events, uint32_t priority, void (*callback)(void*), void* context, uint32_t prescale)
+{
+    generatorCallback[myModule][myPwmGen] = callback;
+    generatorContext[myModule][myPwmGen] = context;
+    interruptPrescale[myModule][myPwmGen] = (prescale == 0) ? 1 : prescale;
+    prescaleCount[myModule][myPwmGen] = interruptPrescale[myModule][myPwmGen];
+
+    //INTCNTZERO, INTCNTLOAD, INTCMPAU, INTCMPAD, INTCMPBU, INTCMPBD
+    (*((volatile uint32_t*)(generatorAddress + PWM0ISC_OFFSET))) = 0x3F;
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0INTEN_OFFSET), events, 0, (5-0)+1, RW);
+
+    //INTPWMn
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + PWMINTEN_OFFSET), (uint32_t)setORClear::set, myPwmGen, 1, RW);
+
+    Nvic::activateInterrupt(generatorInterrupt[myModule][myPwmGen], priority);
+}
+
+/**
+ * @brief Disables the interrupt of the generator. ADC triggers selected with
+ *        \c setAdcTrigger are not affected.
+ */
+void Pwm::disableInterrupt(void)
+{
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + PWMINTEN_OFFSET), (uint32_t)setORClear::clear, myPwmGen, 1, RW);
+    Register::setRegisterBitFieldStatus((volatile uint32_t*)(generatorAddress + PWM0INTEN_OFFSET), 0x0, 0, (5-0)+1, RW);
+    (*((volatile uint32_t*)(generatorAddress + PWM0ISC_OFFSET))) = 0x3F;
+}
+
+/**
+ * @brief Services the interrupt of a generator. Clears the events that 
+ *        fired and calls the callback once every prescale interrupts. Called
+ *        from the PWM generator interrupt vectors.
+ * 
+ * @param module that interrupted
+ * @param generator that interrupted
+ */
+void Pwm::dispatchGenerator(pwmModule module, pwmGenerator generator)
+{
+    volatile uint32_t* isc = (volatile uint32_t*)(pwm0BaseAddress + (module * 0x1000) + PWM0ISC_OFFSET + (0x40 * generator));
+
+    (*isc) = (*isc);
+
+    if(--prescaleCount[module][generator] != 0)
+    {
+        return;
+    }
+
+    prescaleCount[module][generator] = interruptPrescale[module][generator];
+
+    if(generatorCallback[module][generator] != nullptr)
+    {
+        generatorCallback[module][generator](generatorContext[module][generator]);
+    }
+}
+
+/**
+ * @brief Gets the generator used by the PWM pin
+ * 
+ * @return generator 0 to 3
+ */
+uint32_t Pwm::getGenerator(void)
+{
+    return(myPwmGen);
+}
+
+/**
+ * @brief Address of the comparator of the PWM pin, comparator A for an even
+ *        pin and B for an odd pin. Can be used as the destination address of
+ *        a µDMA transfer.
+ * 
+ * @return address of PWMnCMPA or PWMnCMPB
+ */
+volatile uint32_t* Pwm::getCompareAddress(void)
+{
+    return((volatile uint32_t*)(generatorAddress + (((myPwmPin%2) == 0) ? PWM0CMPA_OFFSET : PWM0CMPB_OFFSET)));
+}
+
+/**
+ * @brief Gets the module used by the PWM pin
+ * 
+ * @return module
+ */
+pwmModule Pwm::getModule(void)
+{
+    return(myModule);
+}
+
+/**
+ * @brief Gets the frequency of the PWM clock, the system clock divided by the
+ *        PWM clock divisor when it is enabled.
+ * 
+ * @return PWM clock frequency in Hz
+ */
+uint32_t Pwm::getPwmClockFrequency(void)
+{
+    uint32_t clockFrequency = SystemControl::getClockFrequency();
+
+    if(Register::getRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + RCC_OFFSET), 20, 1, RW) == (uint32_t)setORClear::set)
+    {
+        clockFrequency = clockFrequency >> (Register::getRegisterBitFieldStatus((volatile uint32_t*)(systemControlBase + RCC_OFFSET), 17, (19-17)+1, RW) + 1);
+    }
+
+    return(clockFrequency);
+}
+
+/**
+ * @brief Converts a delay to PWM clock ticks for the dead-band generator,
+ *        limited to the 12-bit delay registers.
+ * 
+ * @param nanoseconds delay
+ * @return delay in PWM clock ticks
+ */
+uint32_t Pwm::nanosecondsToTicks(uint32_t nanoseconds)
+{
+    uint64_t ticks = (((uint64_t)nanoseconds) * getPwmClockFrequency())/1000000000;
+
+    return((ticks > 0xFFF) ? 0xFFF : (uint32_t)ticks);
+}
+
+extern "C" void PWM_0_Fault_Handler(void)
+{
+    Pwm::dispatchFault(module0);
+}
+
+extern "C" void PWM_1_Fault_Handler(void)
+{
+    Pwm::dispatchFault(module1);
+}
+
+extern "C" void PWM_0_Generator_0_Handler(void)
+{
+    Pwm::dispatchGenerator(module0, pwmGen0);
+}
+
+extern "C" void PWM_0_Generator_1_Handler(void)
+{
+    Pwm::dispatchGenerator(module0, pwmGen1);
+}
+
+extern "C" void PWM_0_Generator_2_Handler(void)
+{
+    Pwm::dispatchGenerator(module0, pwmGen2);
+}
+
+extern "C" void PWM_Generator_3_Handler(void)
+{
+    Pwm::dispatchGenerator(module0, pwmGen3);
+}
+
+extern "C" void PWM_1_Generator_0_Handler(void)
+{
+    Pwm::dispatchGenerator(module1, pwmGen0);
+}
+
+extern "C" void PWM_1_Generator_1_Handler(void)
+{
+    Pwm::dispatchGenerator(module1, pwmGen1);
+}
+
+extern "C" void PWM_1_Generator_2_Handler(void)
+{
+    Pwm::dispatchGenerator(module1, pwmGen2);
+}
+
+extern "C" void PWM_1_Generator_3_Handler(void)
+{
+    Pwm::dispatchGenerator(module1, pwmGen3);
+}
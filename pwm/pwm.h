@@ -78,6 +78,64 @@
  *      - PWM generators can be operated independently or synchronized with 
  *        other generators
  * 
+ * Generators are initialized with locally synchronized updates, new load
+ * and comparator values are latched when the counter reaches 0. \c setDuty,
+ * \c setCompare and \c setPeriod are single register stores that can be 
+ * called from a control loop interrupt without glitching the outputs.
+ * 
+ * \c setDeadBand enables the dead-band generator of a complementary pair 
+ * with rising and falling edge delays given in nanoseconds, so half-bridge
+ * gate drivers can be driven directly without shoot-through. Calling it again
+ * updates the delays on the next period.
+ * 
+ * \c initializeFault selects the fault sources of a generator, the fault 
+ * pins (\c MnFAULT0) and the ADC digital comparators, with their polarity, 
+ * latching and a minimum fault period. \c setFaultOutput programs the level
+ * the outputs are driven to during a fault. The shutdown is done by the PWM
+ * hardware, not by software, so it does not wait on interrupt latency. An
+ * optional fault interrupt calls a callback with a context pointer, the 
+ * latched fault status is read with \c getFaultStatus.
+ * 
+ * \c setAdcTrigger selects the counter events of a generator that start an
+ * ADC sample sequence. The sequencer is set up with \c ssTriggerSource::pwmGenN
+ * and \c Adc::selectPwmTriggerModule so the samples are aligned with the PWM 
+ * waveform. In up/down mode the counter reaches \c counterLoad and 
+ * \c counterZero in the middle of the high and low time of a center aligned
+ * output, which is where phase current is sampled away from the switching 
+ * edges.
+ * 
+ * \c enableInterrupt makes a generator the time base of a control loop. The
+ * driver owns the generator vectors, it clears the interrupt and calls the 
+ * callback with a context pointer every \c prescale periods, so a loop can 
+ * run at a fraction of the PWM frequency. The handler clears a single 
+ * register and decrements a counter before the callback, a few tens of 
+ * cycles, which leaves almost all of the 2000 cycles of a 40 kHz loop at 
+ * 80 MHz to the callback.
+ * 
+ * \c initializeFrequency takes the frequency in Hz and the duty cycle in Q16
+ * and picks the smallest PWM clock divisor whose period fits the 16-bit 
+ * counter, for the most duty cycle steps. The divisor in RCC is shared by 
+ * both modules, so the first generator initialized sets it and the later 
+ * ones have to use it. A generator whose frequency can not be reached with 
+ * the divisor already in use is not initialized and \c hasDivisorConflict 
+ * reports it. \c getFrequency and \c getResolution give the frequency and
+ * the number of duty cycle steps actually achieved. With constant arguments
+ * \c PwmFrequency does the same selection at compile time.
+ * 
+ * The outputs of a whole power stage are armed and disarmed together with 
+ * \c enableOutputs, \c disableOutputs and \c setOutputs, which change any
+ * set of the eight outputs of a module with a single store to PWMENABLE. 
+ * \c enableOutputs and \c disableOutputs read PWMENABLE first with 
+ * interrupts disabled, so a fault handler disarming outputs in between is 
+ * not undone.
+ * \c invertOutputs does the same for the polarity in PWMINVERT. With 
+ * \c setEnableUpdate the enable changes of an output are held until the 
+ * counter of its generator reaches 0, so an output never starts or stops 
+ * in the middle of a period.
+ * 
+ * The module is reset the first time one of its generators is initialized,
+ * generators initialized afterwards keep the ones already running.
+ * 
  * For more detailed information on the PWM please see page 1230 of the 
  * TM4C123GH6PM datasheet @ https://www.ti.com/lit/ds/symlink/tm4c123gh6pm.pdf
  * 
@@ -165,6 +223,17 @@ enum class countDirectionPwm{down, upAndDown};
  */
 enum class pwmUnitClockDivisor{_2, _4, _8, _16, _32, _64};
 
+/**
+ * Counter events of a PWM generator, used for interrupts and ADC triggers. 
+ * Values can be or'd together.
+ */
+enum class pwmEvent : uint32_t{counterZero = 0x01, counterLoad = 0x02, compareAUp = 0x04, compareADown = 0x08, compareBUp = 0x10, compareBDown = 0x20};
+
+/**
+ * When a change to PWMENABLE reaches an output, ENUPDn.
+ */
+enum class pwmEnableUpdate{immediate = 0x0, locallySynchronized = 0x2, globallySynchronized = 0x3};
+
 /**
  * Which PWM generator to use
  */
@@ -189,13 +258,177 @@ class Pwm
 
         void initializeSingle(uint32_t pwmPin, pwmModule module, uint32_t period, uint32_t compA, uint32_t compB, countDirectionPwm countDir, uint32_t genOptions, bool enablePwmDiv, uint32_t divisor);
         void initializePair(uint32_t pwmPin, pwmModule module, uint32_t period, uint32_t compA, uint32_t compB, countDirectionPwm countDir, uint32_t genOptionsA, uint32_t genOptionsB, bool enablePwmDiv, uint32_t divisor);
+        bool initializeFrequency(uint32_t pwmPin, pwmModule module, uint32_t hertz, uint32_t dutyQ16, countDirectionPwm countDir);
+
+        void setDutyQ16(uint32_t dutyQ16);
+        void setDutyPercent(uint32_t percent);
+        uint32_t getFrequency(void);
+        uint32_t getResolution(void);
+        static bool hasDivisorConflict(void);
+
+        static void enableOutputs(pwmModule module, uint32_t outputMask);
+        static void disableOutputs(pwmModule module, uint32_t outputMask);
+        static void setOutputs(pwmModule module, uint32_t enabledMask);
+        static void invertOutputs(pwmModule module, uint32_t invertedMask);
+        static void setEnableUpdate(pwmModule module, uint32_t outputMask, pwmEnableUpdate update);
+
+        /**
+         * @brief Largest period in PWM clock ticks the 16-bit counter reaches.
+         * 
+         * @param countDir of the generator
+         * @return period in PWM clock ticks
+         */
+        static constexpr uint32_t maximumTicks(countDirectionPwm countDir)
+        {
+            return((countDir == countDirectionPwm::down) ? 0x10000 : 0x1FFFE);
+        }
+
+        /**
+         * @brief Smallest PWM clock divisor whose period fits the counter, 
+         *        giving the most duty cycle steps.
+         * 
+         * @param clockHertz system clock frequency
+         * @param hertz PWM frequency
+         * @param countDir of the generator
+         * @param shift divisor to start from, the clock is divided by 2^shift
+         * @return divisor as a shift, 0 is undivided and 1 to 6 are 
+         *         \c pwmUnitClockDivisor _2 to _64
+         */
+        static constexpr uint32_t divisorShiftFor(uint32_t clockHertz, uint32_t hertz, countDirectionPwm countDir, uint32_t shift = 0)
+        {
+            return(((shift >= 6) || (((clockHertz >> shift)/hertz) <= maximumTicks(countDir))) ? shift : divisorShiftFor(clockHertz, hertz, countDir, shift + 1));
+        }
+
+        /**
+         * @brief Load value of a generator for a frequency.
+         * 
+         * @param clockHertz system clock frequency
+         * @param hertz PWM frequency
+         * @param countDir of the generator
+         * @param shift divisor, the clock is divided by 2^shift
+         * @return PWMnLOAD value
+         */
+        static constexpr uint32_t loadFor(uint32_t clockHertz, uint32_t hertz, countDirectionPwm countDir, uint32_t shift)
+        {
+            return((countDir == countDirectionPwm::down) ? (((clockHertz >> shift)/hertz) - 1) : (((clockHertz >> shift)/hertz)/2));
+        }
+
+        /**
+         * @brief Frequency a load value gives.
+         * 
+         * @param clockHertz system clock frequency
+         * @param load PWMnLOAD value
+         * @param countDir of the generator
+         * @param shift divisor, the clock is divided by 2^shift
+         * @return frequency in Hz
+         */
+        static constexpr uint32_t frequencyFor(uint32_t clockHertz, uint32_t load, countDirectionPwm countDir, uint32_t shift)
+        {
+            return((clockHertz >> shift)/((countDir == countDirectionPwm::down) ? (load + 1) : (2 * load)));
+        }
+
+        /**
+         * @brief Comparator value for a duty cycle, the output high time 
+         *        being proportional to the duty cycle with the generator 
+         *        options of \c initializeFrequency. Limited to one tick from 
+         *        the ends where the comparator event would coincide with the 
+         *        zero or load event, true 0% and 100% come from the generator
+         *        options of \c genOptionsFor instead.
+         * 
+         * @param load PWMnLOAD value
+         * @param countDir of the generator
+         * @param dutyQ16 duty cycle, 65536 is 100%
+         * @return PWMnCMPA or PWMnCMPB value
+         */
+        static constexpr uint32_t compareFor(uint32_t load, countDirectionPwm countDir, uint32_t dutyQ16)
+        {
+            return(load - limitTicks((uint32_t)((((uint64_t)dutyQ16) * ((countDir == countDirectionPwm::down) ? (load + 1) : load)) >> 16), load));
+        }
+
+        /**
+         * @brief Generator options of a pin initialized with 
+         *        \c initializeFrequency. The output goes high on the load 
+         *        event counting down, or the comparator counting up, and low 
+         *        on the comparator counting down. At 0% and 100% only the 
+         *        zero and load events act, holding the output low or high 
+         *        for the whole period.
+         * 
+         * @param pwmPin output pin, comparator A for an even pin and B for an
+         *        odd pin
+         * @param countDir of the generator
+         * @param dutyQ16 duty cycle, 65536 is 100%
+         * @return PWMnGENA or PWMnGENB value
+         */
+        static constexpr uint32_t genOptionsFor(uint32_t pwmPin, countDirectionPwm countDir, uint32_t dutyQ16)
+        {
+            return((dutyQ16 == 0) ? ((uint32_t)ACTZERO::drivePwmLow | (uint32_t)ACTLOAD::drivePwmLow) : 
+                   (dutyQ16 >= 65536) ? ((uint32_t)ACTZERO::drivPwmHigh | (uint32_t)ACTLOAD::drivPwmHigh) : 
+                   ((pwmPin%2) == 0) ? (((countDir == countDirectionPwm::down) ? (uint32_t)ACTLOAD::drivPwmHigh : (uint32_t)ACTCMPAU::drivPwmHigh) | (uint32_t)ACTCMPAD::drivePwmLow) : 
+                   (((countDir == countDirectionPwm::down) ? (uint32_t)ACTLOAD::drivPwmHigh : (uint32_t)ACTCMPBU::drivPwmHigh) | (uint32_t)ACTCMPBD::drivePwmLow));
+        }
+
+        void setDuty(uint32_t compare);
+        void setCompare(uint32_t compA, uint32_t compB);
+        void setCompareA(uint32_t compA);
+        void setCompareB(uint32_t compB);
+        void setPeriod(uint32_t period);
+
+        void setDeadBand(uint32_t risingNanoseconds, uint32_t fallingNanoseconds);
+        void disableDeadBand(void);
+
+        static uint32_t getPwmClockFrequency(void);
+
+        void initializeFault(uint32_t faultPins, uint32_t digitalComparators, uint32_t activeLowPins, bool latch, uint32_t minimumFaultPeriod);
+        void setFaultOutput(bool levelA, bool levelB);
+        uint32_t getFaultStatus(void);
+        void clearFaultStatus(void);
+        void enableFaultInterrupt(uint32_t priority, void (*callback)(void*), void* context);
+
+        static void dispatchFault(pwmModule module);
+
+        void setAdcTrigger(uint32_t events);
+
+        void enableInterrupt(uint32_t events, uint32_t priority, void (*callback)(void*), void* context, uint32_t prescale);
+        void disableInterrupt(void);
+
+        static void dispatchGenerator(pwmModule module, pwmGenerator generator);
+
+        uint32_t getGenerator(void);
+        volatile uint32_t* getCompareAddress(void);
+        pwmModule getModule(void);
     
     private:
+
+        friend class PwmGroup; // shares the register map below
         
         void initialize(pwmModule module, uint32_t period, countDirectionPwm countDir, bool enablePwmDiv, uint32_t divisor);
+        uint32_t nanosecondsToTicks(uint32_t nanoseconds);
+
+        static constexpr uint32_t limitTicks(uint32_t ticks, uint32_t load)
+        {
+            return((ticks < 1) ? 1 : ((ticks > (load - 1)) ? (load - 1) : ticks));
+        }
 
         uint32_t baseAddress;
+        uint32_t generatorAddress;
         uint32_t myPwmGen;
+        uint32_t myPwmPin;
+        pwmModule myModule;
+
+        static bool moduleInitialized[2];
+        static uint32_t pwmDivisorShift;
+        static bool divisorConflict;
+        static const uint32_t divisorUnset = 0xFF;
+        static void (*faultCallback[2][4])(void*);
+        static void* faultContext[2][4];
+        static void (*generatorCallback[2][4])(void*);
+        static void* generatorContext[2][4];
+        static uint32_t interruptPrescale[2][4];
+        static uint32_t prescaleCount[2][4];
+
+        static constexpr interrupt generatorInterrupt[2][4] = {
+            {PWM_0_Generator_0_Interrupt, PWM_0_Generator_1_Interrupt, PWM_0_Generator_2_Interrupt, PWM_Generator_3_Interrupt},
+            {PWM_1_Generator_0_Interrupt, PWM_1_Generator_1_Interrupt, PWM_1_Generator_2_Interrupt, PWM_1_Generator_3_Interrupt}};
 
         static const uint32_t pwm0BaseAddress = 0x40028000;
         // static const uint32_t pwm1BaseAddress = 0x40029000;
@@ -290,8 +523,10 @@ class Pwm
         static const uint32_t PWM1FLTSEN_OFFSET = 0x880; // 0x880 PWM1FLTSEN RW 0x0000.0000 PWM1 Fault Pin Logic Sense 1297
         static const uint32_t PWM1FLTSTAT0_OFFSET = 0x884; // 0x884 PWM1FLTSTAT0 - 0x0000.0000 PWM1 Fault Status 0 1298
         static const uint32_t PWM1FLTSTAT1_OFFSET = 0x888; // 0x888 PWM1FLTSTAT1 - 0x0000.0000 PWM1 Fault Status 1 1300
+        static const uint32_t PWM2FLTSEN_OFFSET = 0x900; // 0x900 PWM2FLTSEN RW 0x0000.0000 PWM2 Fault Pin Logic Sense 1297
         static const uint32_t PWM2FLTSTAT0_OFFSET = 0x904; // 0x904 PWM2FLTSTAT0 - 0x0000.0000 PWM2 Fault Status 0 1298
         static const uint32_t PWM2FLTSTAT1_OFFSET = 0x908; // 0x908 PWM2FLTSTAT1 - 0x0000.0000 PWM2 Fault Status 1 1300
+        static const uint32_t PWM3FLTSEN_OFFSET = 0x980; // 0x980 PWM3FLTSEN RW 0x0000.0000 PWM3 Fault Pin Logic Sense 1297
         static const uint32_t PWM3FLTSTAT0_OFFSET = 0x984; // 0x984 PWM3FLTSTAT0 - 0x0000.0000 PWM3 Fault Status 0 1298
         static const uint32_t PWM3FLTSTAT1_OFFSET = 0x988; // 0x988 PWM3FLTSTAT1 - 0x0000.0000 PWM3 Fault Status 1 1300
         static const uint32_t PWMPP_OFFSET = 0xFC0; // 0xFC0 PWMPP RO 0x0000.0314 PWM Peripheral Properties 1303
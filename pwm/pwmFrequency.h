@@ -0,0 +1,77 @@
+/**
+ * @file pwmFrequency.h
+ * @brief TM4C123GH6PM PWM Frequency Compile Time Conversion
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class PwmFrequency
+ * @brief Selects the PWM clock divisor and load value for a frequency in Hz
+ *        at compile time.
+ * 
+ * @section pwmFrequencyDescription PWM Frequency Description
+ * 
+ * The smallest divisor whose period fits the 16-bit counter is selected for
+ * a known system clock, giving the most duty cycle steps. A frequency that 
+ * can not be reached fails to compile. The achieved frequency and the 
+ * resolution, the number of PWM clock ticks in a period, are constants that
+ * can be checked with \c static_assert. The results are given to 
+ * \c Pwm::initializeSingle or \c Pwm::initializePair, and the comparator
+ * values computed with \c Pwm::compareFor.
+ * 
+ * @code
+ * typedef PwmFrequency<_80MHz, 20000, countDirectionPwm::upAndDown> motorPwm;
+ * static_assert(motorPwm::resolution >= 2000, "not enough duty cycle steps");
+ * phaseA.initializeSingle(0, module0, motorPwm::load, Pwm::compareFor(motorPwm::load, countDirectionPwm::upAndDown, 0x8000), 0, countDirectionPwm::upAndDown, genOptions, motorPwm::enableDivisor, motorPwm::divisor);
+ * @endcode
+ */
+
+#ifndef PWM_FREQUENCY_H
+#define PWM_FREQUENCY_H
+
+#include "pwm.h"
+
+template<SYSDIV2 clock, uint32_t hertz, countDirectionPwm countDir>
+class PwmFrequency
+{
+    static_assert(hertz >= 1, "frequency has to be at least 1 Hz");
+
+    private:
+        static constexpr uint32_t clockHertz = SystemControl::clockFrequency(clock);
+        static constexpr uint32_t safeHertz = (hertz >= 1) ? hertz : 1;
+
+    public:
+        static constexpr uint32_t divisorShift = Pwm::divisorShiftFor(clockHertz, safeHertz, countDir);
+        static constexpr bool enableDivisor = (divisorShift != 0);
+        static constexpr uint32_t divisor = (divisorShift != 0) ? (divisorShift - 1) : 0;
+        static constexpr uint32_t load = Pwm::loadFor(clockHertz, safeHertz, countDir, divisorShift);
+        static constexpr uint32_t resolution = (countDir == countDirectionPwm::down) ? (load + 1) : (2 * load);
+        static constexpr uint32_t achievedFrequency = Pwm::frequencyFor(clockHertz, load, countDir, divisorShift);
+
+        static_assert(((clockHertz >> divisorShift)/safeHertz) >= 4, "frequency is too high for the PWM clock");
+        static_assert(load <= 0xFFFF, "frequency is too low even with the largest PWM clock divisor");
+};
+
+#endif //PWM_FREQUENCY_H
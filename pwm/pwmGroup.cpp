@@ -0,0 +1,124 @@
+/**
+ * @file pwmGroup.cpp
+ * @brief TM4C123GH6PM PWM Generator Group Definition
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "pwmGroup.h"
+
+/**
+ * @brief empty constructor placeholder
+ */
+PwmGroup::PwmGroup()
+{
+
+}
+
+/**
+ * @brief empty deconstructor placeholder
+ */
+PwmGroup::~PwmGroup()
+{
+
+}
+
+/**
+ * @brief Puts the load and comparator updates of a set of generators into
+ *        globally synchronized mode.
+ * 
+ * @param module the generators belong to
+ * @param generatorMask bit n set for generator n, ie (1 << pwmGen0)
+ */
+void PwmGroup::initialize(pwmModule module, uint32_t generatorMask)
+{
+    baseAddress = Pwm::pwm0BaseAddress + (module * 0x1000);
+    (*this).generatorMask = generatorMask & 0xF;
+
+    for(uint32_t generator = 0; generator < 4; generator++)
+    {
+        if(((*this).generatorMask & (1 << generator)) != 0)
+        {
+            //Globally synchronized LOADUPD, CMPAUPD and CMPBUPD
+            Register::setRegisterBitFieldStatus((volatile uint32_t*)(baseAddress + (Pwm::PWM0CTL_OFFSET + (0x40 * generator))), 0x7, 3, 3, RW);
+        }
+    }
+}
+
+/**
+ * @brief Stages new comparator values for a generator of the group. They
+ *        take effect after \c commit.
+ * 
+ * @param generator of the group
+ * @param compA new comparator A value in clock ticks
+ * @param compB new comparator B value in clock ticks
+ */
+void PwmGroup::stageCompare(pwmGenerator generator, uint32_t compA, uint32_t compB)
+{
+    (*((volatile uint32_t*)(baseAddress + Pwm::PWM0CMPA_OFFSET + (0x40 * generator)))) = compA;
+    (*((volatile uint32_t*)(baseAddress + Pwm::PWM0CMPB_OFFSET + (0x40 * generator)))) = compB;
+}
+
+/**
+ * @brief Stages a new period for a generator of the group. It takes effect
+ *        after \c commit.
+ * 
+ * @param generator of the group
+ * @param period new period in clock ticks
+ */
+void PwmGroup::stagePeriod(pwmGenerator generator, uint32_t period)
+{
+    (*((volatile uint32_t*)(baseAddress + Pwm::PWM0LOAD_OFFSET + (0x40 * generator)))) = period;
+}
+
+/**
+ * @brief Requests a synchronous update of every generator in the group with
+ *        a single store to the GLOBALSYNC bits of PWMCTL. Each generator 
+ *        latches its staged values the next time its counter reaches 0.
+ */
+void PwmGroup::commit(void)
+{
+    (*((volatile uint32_t*)(baseAddress + Pwm::PWMCTL_OFFSET))) = generatorMask;
+}
+
+/**
+ * @brief Checks if a committed update has not been latched by all generators
+ *        yet. Values staged before then would be part of the same update.
+ * 
+ * @return true while the update is pending
+ */
+bool PwmGroup::isCommitPending(void)
+{
+    return(((*((volatile uint32_t*)(baseAddress + Pwm::PWMCTL_OFFSET))) & generatorMask) != 0);
+}
+
+/**
+ * @brief Resets the counters of every generator in the group at the same 
+ *        time through PWMSYNC, aligning their phases.
+ */
+void PwmGroup::resetCounters(void)
+{
+    (*((volatile uint32_t*)(baseAddress + Pwm::PWMSYNC_OFFSET))) = generatorMask;
+}
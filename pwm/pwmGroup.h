@@ -0,0 +1,86 @@
+/**
+ * @file pwmGroup.h
+ * @brief TM4C123GH6PM PWM Generator Group Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class PwmGroup
+ * @brief TM4C123GH6PM Globally Synchronized PWM Generator Group
+ * 
+ * @section pwmGroupDescription PWM Group Description
+ * 
+ * A PwmGroup puts a set of generators of one PWM module in globally 
+ * synchronized update mode. New load and comparator values written to the
+ * generators of the group, with \c stageCompare, \c stagePeriod or the 
+ * setters of \c Pwm, are held until \c commit requests a synchronous update
+ * with a single store to PWMCTL. Every generator then latches its new values
+ * the next time its counter reaches 0, so no generator ever runs a period 
+ * with a mix of old and new values. This is needed by three-phase inverters
+ * where all phases have to change on the same period boundary.
+ * 
+ * \c resetCounters resets the counters of every generator in the group at 
+ * once through PWMSYNC to align their phases.
+ * 
+ * The generators have to be initialized with \c Pwm before they are added
+ * to a group.
+ * 
+ * @code
+ * PwmGroup inverter;
+ * inverter.initialize(module0, (1 << pwmGen0) | (1 << pwmGen1) | (1 << pwmGen2));
+ * inverter.resetCounters();
+ * inverter.stageCompare(pwmGen0, phaseA, phaseA);
+ * inverter.stageCompare(pwmGen1, phaseB, phaseB);
+ * inverter.stageCompare(pwmGen2, phaseC, phaseC);
+ * inverter.commit();
+ * @endcode
+ */
+
+#ifndef PWM_GROUP_H
+#define PWM_GROUP_H
+
+#include "pwm.h"
+
+class PwmGroup
+{
+    public:
+        PwmGroup();
+        ~PwmGroup();
+
+        void initialize(pwmModule module, uint32_t generatorMask);
+        void stageCompare(pwmGenerator generator, uint32_t compA, uint32_t compB);
+        void stagePeriod(pwmGenerator generator, uint32_t period);
+        void commit(void);
+        bool isCommitPending(void);
+        void resetCounters(void);
+
+    private:
+
+        uint32_t baseAddress;
+        uint32_t generatorMask;
+};
+
+#endif //PWM_GROUP_H
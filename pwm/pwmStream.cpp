@@ -0,0 +1,117 @@
+/**
+ * @file pwmStream.cpp
+ * @brief TM4C123GH6PM µDMA Streamed PWM Compare Definition
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "pwmStream.h"
+
+/**
+ * @brief Constructs a stream without a PWM pin, timer or channel, 
+ *        \c initialize assigns them.
+ */
+PwmStream::PwmStream()
+{
+    pwm = nullptr;
+    timer = nullptr;
+    dma = nullptr;
+}
+
+/**
+ * @brief empty deconstructor placeholder
+ */
+PwmStream::~PwmStream()
+{
+
+}
+
+/**
+ * @brief Assigns the PWM pin, the pacing timer and the µDMA channel of the
+ *        stream. The PWM pin and the timer have to be initialized, the timer
+ *        in periodic mode with the sample period.
+ * 
+ * @param pwm pin whose comparator is streamed
+ * @param timer that paces the stream, one item per timeout
+ * @param dma channel, assigned to the timer
+ * @param interruptPriority of the transfer completion interrupt
+ * @return false if no µDMA channel of the timer is free
+ */
+bool PwmStream::initialize(Pwm* pwm, GeneralPurposeTimer* timer, Dma* dma, uint32_t interruptPriority)
+{
+    (*this).pwm = pwm;
+    (*this).timer = timer;
+    (*this).dma = dma;
+
+    if(!(*timer).attachDma(dma))
+    {
+        return(false);
+    }
+
+    (*timer).enableDmaInterrupt(interruptPriority, Dma::pingPongComplete, dma);
+    return(true);
+}
+
+/**
+ * @brief Starts streaming a buffer of compare values made of two halves 
+ *        with the ping-pong mode of the µDMA. Once a half has been moved the
+ *        controller continues with the other half without a gap, and the 
+ *        refill callback is called with the half that is free again. The 
+ *        timer has to be enabled to start the stream.
+ * 
+ * @param buffer of 2 * itemsPerHalf compare values in SRAM
+ * @param itemsPerHalf number of compare values in each half, 1 to 1024
+ * @param refill called from the interrupt with the context and the half, 0
+ *        or 1, that can be refilled. May be nullptr to repeat the buffer.
+ * @param context passed to the refill callback
+ * @return false if the stream has no µDMA channel or the buffer is in 
+ *         flash, which the µDMA can not read, nothing is started
+ */
+bool PwmStream::start(const volatile uint32_t* buffer, uint32_t itemsPerHalf, void (*refill)(void*, uint32_t), void* context)
+{
+    if((dma == nullptr) || !(*dma).isAllocated() || !Dma::reachable((uint32_t)(uintptr_t)buffer))
+    {
+        return(false);
+    }
+
+    volatile uint32_t* compare = (*pwm).getCompareAddress();
+
+    (*dma).startPingPong(buffer, buffer + itemsPerHalf, dmaIncrement::_32Bit, compare, compare, dmaIncrement::none, dmaDataSize::_32Bit, itemsPerHalf, dmaArbitrationSize::_1, refill, context);
+
+    return(true);
+}
+
+/**
+ * @brief Stops the stream, the comparator keeps the last value.
+ */
+void PwmStream::stop(void)
+{
+    if(dma == nullptr)
+    {
+        return;
+    }
+
+    (*dma).disable();
+}
@@ -0,0 +1,87 @@
+/**
+ * @file pwmStream.h
+ * @brief TM4C123GH6PM µDMA Streamed PWM Compare Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class PwmStream
+ * @brief µDMA Streamed PWM Compare Values
+ * 
+ * @section pwmStreamDescription PWM Stream Description
+ * 
+ * A PwmStream moves a table of compare values into the comparator of a PWM
+ * pin, one value per timeout of a general purpose timer, with a µDMA 
+ * channel. Audio or LED waveforms are synthesized without an interrupt per
+ * sample, the CPU only takes one interrupt per half buffer. The PWM module
+ * of the TM4C123GH6PM has no µDMA requests, so the stream is paced by a 
+ * timer running at the sample rate.
+ * 
+ * The buffer is split into two halves moved in the ping-pong mode of the 
+ * µDMA, so there is no gap between them. While one half is being moved the
+ * other can be refilled from the refill callback, which is called each time
+ * a half completes, for continuous synthesis. Without a refill callback the
+ * buffer is repeated as a circular table. The µDMA can only read SRAM and 
+ * the peripherals, a \c const table must not be placed in flash and 
+ * \c start refuses one that is.
+ * 
+ * The PWM period should be a multiple of the sample period or shorter, the
+ * comparator latches each new value at the next counter zero. 
+ * \c benchmarks/streamBenchmark.cpp compares the CPU load of a 48 kHz 
+ * stream with a timer interrupt per sample on the board.
+ * 
+ * @code
+ * sampleTimer.initializeForPolling(periodic, shortTimer1, TimerFrequency<_80MHz, 48000, shortTimer1, timerA>::clockCycles, down, timerA, nullptr);
+ * audio.initialize(&speakerPwm, &sampleTimer, &streamDma, 2);
+ * audio.start(samples, 128, refillSamples, &synthesizer);
+ * sampleTimer.enableTimer();
+ * @endcode
+ */
+
+#ifndef PWM_STREAM_H
+#define PWM_STREAM_H
+
+#include "pwm.h"
+#include "../timer/generalPurposeTimer.h"
+
+class PwmStream
+{
+    public:
+        PwmStream();
+        ~PwmStream();
+
+        bool initialize(Pwm* pwm, GeneralPurposeTimer* timer, Dma* dma, uint32_t interruptPriority);
+        bool start(const volatile uint32_t* buffer, uint32_t itemsPerHalf, void (*refill)(void*, uint32_t), void* context);
+        void stop(void);
+
+    private:
+
+        Pwm* pwm;
+        GeneralPurposeTimer* timer;
+        Dma* dma;
+};
+
+#endif //PWM_STREAM_H
@@ -0,0 +1,171 @@
+/**
+ * @file spaceVectorPwm.cpp
+ * @brief TM4C123GH6PM Space Vector and Sine PWM Definition
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include "spaceVectorPwm.h"
+
+/**
+ * One period of a sine in Q15, 256 entries. Being const it stays in flash.
+ */
+const int16_t SpaceVectorPwm::sineTable[256] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+    30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+    23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+    12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+    0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804};
+
+/**
+ * @brief empty constructor placeholder
+ */
+SpaceVectorPwm::SpaceVectorPwm()
+{
+
+}
+
+/**
+ * @brief empty deconstructor placeholder
+ */
+SpaceVectorPwm::~SpaceVectorPwm()
+{
+
+}
+
+/**
+ * @brief Groups the three phase generators for synchronized updates. The 
+ *        generators have to be initialized with \c Pwm in up/down mode with 
+ *        \c period as their load value and the generator options of
+ *        \c Pwm::compareFor.
+ * 
+ * @param module the generators belong to
+ * @param phaseA generator of phase A
+ * @param phaseB generator of phase B
+ * @param phaseC generator of phase C
+ * @param period load value of the generators
+ * @param mode spaceVector or sine modulation
+ */
+void SpaceVectorPwm::initialize(pwmModule module, pwmGenerator phaseA, pwmGenerator phaseB, pwmGenerator phaseC, uint32_t period, pwmModulation mode)
+{
+    phaseGenerator[0] = phaseA;
+    phaseGenerator[1] = phaseB;
+    phaseGenerator[2] = phaseC;
+    (*this).period = period;
+    (*this).mode = mode;
+
+    group.initialize(module, (1 << phaseA) | (1 << phaseB) | (1 << phaseC));
+    group.resetCounters();
+}
+
+/**
+ * @brief Sets the output voltage vector in polar form and commits the new
+ *        compare values of the three phases in one synchronized update.
+ * 
+ * @param angle electrical angle, a full turn is 65536
+ * @param amplitude Q15, 1.0 is the largest amplitude without overmodulation
+ */
+void SpaceVectorPwm::setVoltagePolar(uint16_t angle, int16_t amplitude)
+{
+    int16_t alpha = (int16_t)((amplitude * sine((uint16_t)(angle + 0x4000))) >> 15);
+    int16_t beta = (int16_t)((amplitude * sine(angle)) >> 15);
+
+    setVoltageAlphaBeta(alpha, beta);
+}
+
+/**
+ * @brief Sets the output voltage vector in the stationary alpha/beta frame 
+ *        and commits the new compare values of the three phases in one 
+ *        synchronized update.
+ * 
+ * @param alpha Q15
+ * @param beta Q15
+ */
+void SpaceVectorPwm::setVoltageAlphaBeta(int16_t alpha, int16_t beta)
+{
+    //Inverse Clarke transform, sqrt(3)/2 = 28378 in Q15
+    int32_t phase[3];
+    phase[0] = alpha;
+    phase[1] = ((-alpha * 16384) + (beta * 28378)) >> 15;
+    phase[2] = ((-alpha * 16384) - (beta * 28378)) >> 15;
+
+    int32_t offset = 0;
+    int32_t gain = 16384;
+
+    if(mode == pwmModulation::spaceVector)
+    {
+        //Min/max injection, centers the phases and gains 1/sqrt(3) = 18919 in Q15
+        int32_t maximum = phase[0];
+        int32_t minimum = phase[0];
+
+        for(uint32_t i = 1; i < 3; i++)
+        {
+            maximum = (phase[i] > maximum) ? phase[i] : maximum;
+            minimum = (phase[i] < minimum) ? phase[i] : minimum;
+        }
+
+        offset = -((maximum + minimum) >> 1);
+        gain = 18919;
+    }
+
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        int32_t duty = 16384 + (((phase[i] + offset) * gain) >> 15);
+        duty = (duty < 0) ? 0 : ((duty > 32768) ? 32768 : duty);
+
+        uint32_t compare = Pwm::compareFor(period, countDirectionPwm::upAndDown, ((uint32_t)duty) << 1);
+        group.stageCompare(phaseGenerator[i], compare, compare);
+    }
+
+    group.commit();
+}
+
+/**
+ * @brief Sine of an angle from the flash table with linear interpolation 
+ *        between entries.
+ * 
+ * @param angle a full turn is 65536
+ * @return sine in Q15
+ */
+int16_t SpaceVectorPwm::sine(uint16_t angle)
+{
+    uint32_t index = angle >> 8;
+    int32_t fraction = angle & 0xFF;
+    int32_t first = sineTable[index];
+    int32_t second = sineTable[(index + 1) & 0xFF];
+
+    return((int16_t)(first + (((second - first) * fraction) >> 8)));
+}
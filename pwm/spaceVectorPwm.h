@@ -0,0 +1,99 @@
+/**
+ * @file spaceVectorPwm.h
+ * @brief TM4C123GH6PM Space Vector and Sine PWM Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class SpaceVectorPwm
+ * @brief Three-Phase Space Vector and Sine PWM
+ * 
+ * @section spaceVectorPwmDescription Space Vector PWM Description
+ * 
+ * SpaceVectorPwm drives a three-phase inverter from three generators of one
+ * PWM module. The output voltage is given in Q15, as an angle and amplitude
+ * or as alpha and beta, and turned into the compare values of the three 
+ * phases. The new compare values are committed through a \c PwmGroup so all
+ * phases change on the same period boundary.
+ * 
+ * With \c pwmModulation::spaceVector the common mode min/max offset is added
+ * to the phase voltages, which is equivalent to the classic sector based 
+ * space vector modulation and uses 15% more of the DC bus than sine 
+ * modulation. With \c pwmModulation::sine the phases are plain sines.
+ * 
+ * Sines come from a 256 entry Q15 table in flash with linear interpolation,
+ * the update is integer only and has no divisions. \c test/spaceVectorPwmThd
+ * runs it on the host over an electrical cycle and reports the distortion 
+ * of the line voltage and of the current of an RL load, below 0.4% at every
+ * modulation index it sweeps.
+ * 
+ * The generators are run in up/down mode for center aligned outputs, with 
+ * the generator options of \c Pwm::initializeFrequency, 
+ * \c ACTCMPAU::drivPwmHigh and \c ACTCMPAD::drivePwmLow. The compare values
+ * come from \c Pwm::compareFor, so they stay one tick away from zero and 
+ * the load value where the comparator event would coincide with the zero 
+ * or load event, at full modulation as well.
+ * 
+ * @code
+ * SpaceVectorPwm inverter;
+ * inverter.initialize(module0, pwmGen0, pwmGen1, pwmGen2, period, pwmModulation::spaceVector);
+ * inverter.setVoltagePolar(angle, amplitude);
+ * @endcode
+ */
+
+#ifndef SPACE_VECTOR_PWM_H
+#define SPACE_VECTOR_PWM_H
+
+#include "pwmGroup.h"
+
+/**
+ * Modulation of the three phases
+ */
+enum class pwmModulation{sine, spaceVector};
+
+class SpaceVectorPwm
+{
+    public:
+        SpaceVectorPwm();
+        ~SpaceVectorPwm();
+
+        void initialize(pwmModule module, pwmGenerator phaseA, pwmGenerator phaseB, pwmGenerator phaseC, uint32_t period, pwmModulation mode);
+        void setVoltagePolar(uint16_t angle, int16_t amplitude);
+        void setVoltageAlphaBeta(int16_t alpha, int16_t beta);
+
+        static int16_t sine(uint16_t angle);
+
+    private:
+
+        PwmGroup group;
+        pwmGenerator phaseGenerator[3];
+        uint32_t period;
+        pwmModulation mode;
+
+        static const int16_t sineTable[256];
+};
+
+#endif //SPACE_VECTOR_PWM_H
@@ -51,6 +51,7 @@
 #include <stdlib.h>
 
 using std::uint32_t;
+using std::uint64_t;
 
 /**
  * Set or Clear a register bit
@@ -29,6 +29,8 @@
 
 #include "systemControl.h"
 
+uint32_t SystemControl::currentClockFrequency = piOscFrequency;
+
 /**
  * @brief empty constructor placeholder
  */
@@ -92,5 +94,18 @@ void SystemControl::initializeClock(SYSDIV2 frequency)
 	}
 	
 	Register::setRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + RCC2_OFFSET)), (uint32_t)setORClear::clear, 11, 1, RW); // 6. Enable use of the PLL by clearing BYPASS.
+
+	currentClockFrequency = clockFrequency(frequency);
+}
+
+/**
+ * @brief Gets the current system clock frequency. The precision internal
+ *        oscillator frequency until \c initializeClock is called.
+ *
+ * @return system clock frequency in Hz
+ */ 
+uint32_t SystemControl::getClockFrequency(void)
+{
+	return(currentClockFrequency);
 }
 
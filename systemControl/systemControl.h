@@ -144,9 +144,27 @@ class SystemControl
 
         static void initializeGPIOHB(void);
         static void initializeClock(SYSDIV2 frequency);
+        static uint32_t getClockFrequency(void);
+
+        /**
+         * @brief System clock frequency in Hz for a PLL divisor, usable at
+         *        compile time.
+         * 
+         * @param frequency the PLL is programmed to
+         * @return system clock frequency in Hz
+         */
+        static constexpr uint32_t clockFrequency(SYSDIV2 frequency)
+        {
+            return(pllFrequency/frequency);
+        }
 
     private:
 
+        static uint32_t currentClockFrequency;
+
+        static const uint32_t pllFrequency = 400000000; // 400 MHz PLL output divided down by SYSDIV2
+        static const uint32_t piOscFrequency = 16000000; // 16 MHz precision internal oscillator used out of reset
+
         static const uint32_t RCC_OFFSET = 0x060; //RCC RW 0x078E.3AD1 Run-Mode Clock Configuration 254
         static const uint32_t RCC2_OFFSET = 0x070; //RCC2 RW 0x07C0.6810 Run-Mode Clock Configuration 2 260
         static const uint32_t RIS_OFFSET = 0x050; //0x050 RIS RO 0x0000.0000 Raw Interrupt Status 244
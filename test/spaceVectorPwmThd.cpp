@@ -0,0 +1,193 @@
+/**
+ * @file spaceVectorPwmThd.cpp
+ * @brief Host harness for the total harmonic distortion of SpaceVectorPwm
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * Runs the integer update of SpaceVectorPwm on the host. PwmGroup is 
+ * replaced by the stubs below, which keep the staged compare values instead
+ * of writing the generators. The angle is swept over one electrical cycle 
+ * of \c updatesPerCycle PWM periods, each compare value is turned into the 
+ * average leg voltage of its period and applied to a star connected RL 
+ * load. The switching ripple is not modeled, the distortion reported is the 
+ * one of the update itself: sine table, Q15 arithmetic and compare 
+ * quantization.
+ * 
+ * Prints the fundamental of the line voltage, relative to the DC bus, and 
+ * the THD of the line voltage and of the load current up to 
+ * \c highestHarmonic. Returns 1 if a linear modulation index has a voltage
+ * THD above \c thdLimit.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include "../pwm/spaceVectorPwm.h"
+
+static const uint32_t updatesPerCycle = 800; // 50 Hz at a 40 kHz PWM frequency
+static const uint32_t cyclesToSettle = 5;
+static const uint32_t highestHarmonic = 50;
+static const uint32_t period = 1000; // load value, 40 kHz up/down at 80 MHz
+static const double loadTimeConstant = 80.0; // L/R in PWM periods, 2 ms
+static const double thdLimit = 0.01;
+
+static uint32_t stagedCompare[4];
+
+PwmGroup::PwmGroup()
+{
+
+}
+
+PwmGroup::~PwmGroup()
+{
+
+}
+
+void PwmGroup::initialize(pwmModule module, uint32_t generatorMask)
+{
+    (void)module;
+    (*this).generatorMask = generatorMask;
+}
+
+void PwmGroup::stageCompare(pwmGenerator generator, uint32_t compA, uint32_t compB)
+{
+    (void)compB;
+    stagedCompare[generator] = compA;
+}
+
+void PwmGroup::commit(void)
+{
+
+}
+
+void PwmGroup::resetCounters(void)
+{
+
+}
+
+/**
+ * @brief Magnitude of one harmonic of a cycle of samples.
+ */
+static double harmonic(const double* samples, uint32_t n)
+{
+    double real = 0;
+    double imaginary = 0;
+
+    for(uint32_t k = 0; k < updatesPerCycle; k++)
+    {
+        double angle = 2.0 * M_PI * n * k / updatesPerCycle;
+        real += samples[k] * cos(angle);
+        imaginary -= samples[k] * sin(angle);
+    }
+
+    return(2.0 * sqrt((real * real) + (imaginary * imaginary)) / updatesPerCycle);
+}
+
+/**
+ * @brief Total harmonic distortion of a cycle of samples.
+ */
+static double thd(const double* samples, double* fundamental)
+{
+    double sum = 0;
+
+    for(uint32_t n = 2; n <= highestHarmonic; n++)
+    {
+        double magnitude = harmonic(samples, n);
+        sum += magnitude * magnitude;
+    }
+
+    *fundamental = harmonic(samples, 1);
+    return(sqrt(sum) / *fundamental);
+}
+
+/**
+ * @brief Sweeps one operating point and prints its distortion.
+ * 
+ * @return voltage THD
+ */
+static double sweep(pwmModulation mode, double modulationIndex)
+{
+    static double lineVoltage[updatesPerCycle];
+    static double loadCurrent[updatesPerCycle];
+
+    SpaceVectorPwm inverter;
+    inverter.initialize(module0, pwmGen0, pwmGen1, pwmGen2, period, mode);
+
+    int16_t amplitude = (int16_t)((modulationIndex * 32768.0 > 32767.0) ? 32767 : (modulationIndex * 32768.0));
+    double current = 0;
+
+    for(uint32_t cycle = 0; cycle < cyclesToSettle; cycle++)
+    {
+        for(uint32_t k = 0; k < updatesPerCycle; k++)
+        {
+            inverter.setVoltagePolar((uint16_t)((k * 65536) / updatesPerCycle), amplitude);
+
+            double leg[3];
+
+            for(uint32_t i = 0; i < 3; i++)
+            {
+                //High time proportional to load - compare, see Pwm::compareFor
+                leg[i] = (double)(period - stagedCompare[i]) / period;
+            }
+
+            double phaseVoltage = leg[0] - ((leg[0] + leg[1] + leg[2]) / 3.0);
+            current += (phaseVoltage - current) / loadTimeConstant;
+
+            lineVoltage[k] = leg[0] - leg[1];
+            loadCurrent[k] = current;
+        }
+    }
+
+    double fundamental;
+    double currentFundamental;
+    double voltageThd = thd(lineVoltage, &fundamental);
+    double currentThd = thd(loadCurrent, &currentFundamental);
+
+    printf("%-12s %5.2f %9.4f %9.4f%% %9.4f%%\n", (mode == pwmModulation::spaceVector) ? "spaceVector" : "sine", modulationIndex, fundamental, 100.0 * voltageThd, 100.0 * currentThd);
+
+    return(voltageThd);
+}
+
+int main(void)
+{
+    static const double modulationIndex[] = {0.1, 0.5, 0.9, 1.0};
+    int result = 0;
+
+    printf("%-12s %5s %9s %10s %10s\n", "modulation", "index", "line Vdc", "V THD", "I THD");
+
+    for(uint32_t m = 0; m < 2; m++)
+    {
+        for(uint32_t i = 0; i < (sizeof(modulationIndex)/sizeof(modulationIndex[0])); i++)
+        {
+            if(sweep((m == 0) ? pwmModulation::sine : pwmModulation::spaceVector, modulationIndex[i]) > thdLimit)
+            {
+                result = 1;
+            }
+        }
+    }
+
+    return(result);
+}
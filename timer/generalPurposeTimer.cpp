@@ -49,6 +49,18 @@ const uint32_t GeneralPurposeTimer::GPTMTnV_OFFSET[2] = {GPTMTAV_OFFSET, GPTMTBV
 const uint32_t GeneralPurposeTimer::GPTMTnPS_OFFSET[2] = {GPTMTAPS_OFFSET, GPTMTBPS_OFFSET};
 const uint32_t GeneralPurposeTimer::GPTMTnPV_OFFSET[2] = {GPTMTAPV_OFFSET, GPTMTBPV_OFFSET};
 
+constexpr interrupt GeneralPurposeTimer::timerInterrupt[12][2];
+
+GeneralPurposeTimer* GeneralPurposeTimer::registeredTimers[12][2] = {};
+
+const dmaPeripheral GeneralPurposeTimer::timerDmaPeripheral[12][2] = {
+    {dmaPeripheral::timer0A, dmaPeripheral::timer0B}, {dmaPeripheral::timer1A, dmaPeripheral::timer1B},
+    {dmaPeripheral::timer2A, dmaPeripheral::timer2B}, {dmaPeripheral::timer3A, dmaPeripheral::timer3B},
+    {dmaPeripheral::timer4A, dmaPeripheral::timer4B}, {dmaPeripheral::timer5A, dmaPeripheral::timer5B},
+    {dmaPeripheral::wideTimer0A, dmaPeripheral::wideTimer0B}, {dmaPeripheral::wideTimer1A, dmaPeripheral::wideTimer1B},
+    {dmaPeripheral::wideTimer2A, dmaPeripheral::wideTimer2B}, {dmaPeripheral::wideTimer3A, dmaPeripheral::wideTimer3B},
+    {dmaPeripheral::wideTimer4A, dmaPeripheral::wideTimer4B}, {dmaPeripheral::wideTimer5A, dmaPeripheral::wideTimer5B}};
+
 /**
  * @brief empty constructor placeholder
  */
@@ -73,14 +85,32 @@ GeneralPurposeTimer::~GeneralPurposeTimer()
  *        time capture, or PWM
  * @param block of the timer used. There are six A&B short timers and six A&B
  *        wide timers.
- * @param clockCycles period in clock ticks/cycles
+ * @param clockCycles period in clock ticks/cycles. Up to 64-bits for a
+ *        concatenated wide timer.
  * @param direction of the timer count
  * @param use of timer. Timer A, Timer B, or concatonated
- *  
+ * @param event edge of the CCP pin used in the capture modes
+ * @return false if the period does not fit the timer, or the mode is not 
+ *         available on it, nothing is changed
  */
-void GeneralPurposeTimer::initialize(timerMode mode, timerBlock block, uint32_t clockCycles, countDirection dir, timerUse use)
+bool GeneralPurposeTimer::initialize(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event)
 {
+    //The period has to fit the timer with the prescaler, the capture and PWM modes only run on the individual timers
+    if(((mode == oneShot) || (mode == periodic) || (mode == edgeCount) || (mode == PWM)) && ((clockCycles == 0) || (clockCycles > maximumClockCycles(block, ((mode == oneShot) || (mode == periodic)) ? use : timerA))))
+    {
+        return(false);
+    }
+
+    //RTC mode is only available on concatenated short timers
+    if((mode == realTimeClock) && (((block/6) != 0) || (use != concatenated)))
+    {
+        return(false);
+    }
+
     (*this).use = use;
+    (*this).block = block;
+    (*this).dir = dir;
+    (*this).event = event;
     clockCycles = clockCycles - 1;
     baseAddress = timerBaseAddresses[block];
 
@@ -103,18 +133,23 @@ void GeneralPurposeTimer::initialize(timerMode mode, timerBlock block, uint32_t
         //3. Configure for One-Shot or Periodic mode
         Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), mode + 1, 0, 2, RW);
 
-        //4. Optional configuration. Configure for count direction
-        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), dir, 4, 1, RW);
+        //4. Optional configuration. Configure for count direction, TnCDIR set counts up
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), ((dir == up) ? 0x1 : 0x0), 4, 1, RW);
         
-        //5. Interval load
-        if(use == timerA)
+        //5. Interval load, individual short timers are 16-bits and individual wide timers are 32-bits. When counting down
+        //   the prescaler divides the clock, counting up it extends the timer, up to 24-bits for short and 48-bits for wide timers.
+        if(use != concatenated)
         {
-            Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTAILR_OFFSET)), clockCycles, 0, 16, RW);
-        }
+            if(dir == down)
+            {
+                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnILR_OFFSET[(use%2)])), (uint32_t)loadFor(clockCycles + 1, block), 0, (((block/6) == 0) ? 16 : 32), RW);
+                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnPR_OFFSET[(use%2)])), prescaleFor(clockCycles + 1, block), 0, (((block/6) == 0) ? 8 : 16), RW);
+            }
 
-        else if(use == timerB)
-        {
-            Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTBILR_OFFSET)), clockCycles, 0, 16, RW);
+            else
+            {
+                setExtendedRegister(GPTMTnILR_OFFSET[(use%2)], GPTMTnPR_OFFSET[(use%2)], clockCycles);
+            }
         }
 
         else if(use == concatenated)
@@ -123,16 +158,16 @@ void GeneralPurposeTimer::initialize(timerMode mode, timerBlock block, uint32_t
             if((block/6) == 0)
             {
                 // GPTMTAILR.setRegisterBitFieldStatus(GPTMTAILR_TAILR, clockCycles);
-                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTAILR_OFFSET)), clockCycles, 0, 32, RW); //This is where the problems begin with reg B
+                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTAILR_OFFSET)), (uint32_t)clockCycles, 0, 32, RW); //This is where the problems begin with reg B
                 Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTAPR_OFFSET)), (uint32_t)setORClear::clear, 0, 8, RW);
 
             }
 
-            //concatenated wide timer
+            //concatenated wide timer, GPTMTAILR holds the lower 32 bits and GPTMTBILR the upper 32 bits
             else
             {
-                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTBILR_OFFSET)), ((clockCycles & 0xFFFFFFFF00000000) >> 32), 0, 32, RW);
-                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTAILR_OFFSET)), (clockCycles & 0x00000000FFFFFFFF), 0, 32, RW);
+                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTBILR_OFFSET)), (uint32_t)((clockCycles & 0xFFFFFFFF00000000) >> 32), 0, 32, RW);
+                Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTAILR_OFFSET)), (uint32_t)(clockCycles & 0x00000000FFFFFFFF), 0, 32, RW);
             }
         }
 
@@ -141,25 +176,113 @@ void GeneralPurposeTimer::initialize(timerMode mode, timerBlock block, uint32_t
     else if(mode == realTimeClock)
     {
         rawInterruptStatusBit = 3;
+
+        //2. Configure for RTC mode, the 32.768 kHz clock on the even CCP pin is divided down to 1 Hz
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCFG_OFFSET)), 0x1, 0, 3, RW);
+
+        //3. No alarm until one is set with setRtcAlarm
+        (*((volatile uint32_t*)(baseAddress + GPTMTAMATCHR_OFFSET))) = 0xFFFFFFFF;
+
+        //4. Keep counting when the CPU is halted by the debugger (RTCEN), do not stall (TASTALL)
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), (uint32_t)setORClear::set, 4, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), (uint32_t)setORClear::clear, 1, 1, RW);
+
+        //5. Start counting seconds from 0
+        (*((volatile uint32_t*)(baseAddress + GPTMTAV_OFFSET))) = 0;
     }
 
     else if(mode == edgeCount)
     {
         rawInterruptStatusBit = ((use == timerB) ? 9 : 1);
+
+        //2. Capture modes only run on the individual timers
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCFG_OFFSET)), 0x4, 0, 3, RW);
+
+        //3. Configure for capture mode (TnMR = 0x3), edge-count (TnCMR = 0) and capture/compare (TnAMS = 0)
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), 0x3, 0, 2, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::clear, 2, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::clear, 3, 1, RW);
+
+        //4. Configure for count direction, TnCDIR set counts up
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), ((dir == up) ? 0x1 : 0x0), 4, 1, RW);
+
+        //5. Configure the edge that is counted
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), event, ((use%2)*8) + 2, 2, RW);
+
+        //6. Load and match, the prescaler extends both to 24-bits for short and 48-bits for wide timers. 
+        //   clockCycles was reduced by one above, the target is the number of edges counted before the match.
+        if(dir == down)
+        {
+            setExtendedRegister(GPTMTnILR_OFFSET[(use%2)], GPTMTnPR_OFFSET[(use%2)], clockCycles + 1);
+            setExtendedRegister(GPTMTnMATCHR_OFFSET[(use%2)], GPTMTnPMR_OFFSET[(use%2)], 0);
+        }
+
+        else
+        {
+            setExtendedRegister(GPTMTnILR_OFFSET[(use%2)], GPTMTnPR_OFFSET[(use%2)], (((block/6) == 0) ? 0x0000000000FFFFFF : 0x0000FFFFFFFFFFFF));
+            setExtendedRegister(GPTMTnMATCHR_OFFSET[(use%2)], GPTMTnPMR_OFFSET[(use%2)], clockCycles + 1);
+        }
     }
 
     else if(mode == edgeTime)
     {
         rawInterruptStatusBit = ((use == timerB) ? 10 : 2);
+
+        //2. Capture modes only run on the individual timers
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCFG_OFFSET)), 0x4, 0, 3, RW);
+
+        //3. Configure for capture mode (TnMR = 0x3), edge-time (TnCMR = 1) and capture/compare (TnAMS = 0)
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), 0x3, 0, 2, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::set, 2, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::clear, 3, 1, RW);
+
+        //4. Configure for count direction, TnCDIR set counts up
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), ((dir == up) ? 0x1 : 0x0), 4, 1, RW);
+
+        //5. Configure the edge that is captured
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), event, ((use%2)*8) + 2, 2, RW);
+
+        //6. Free run over the full counter range, the prescaler acts as a timer extension in capture mode
+        setExtendedRegister(GPTMTnILR_OFFSET[(use%2)], GPTMTnPR_OFFSET[(use%2)], (((block/6) == 0) ? 0x0000000000FFFFFF : 0x0000FFFFFFFFFFFF));
+
+        captureHistory[0] = 0;
+        captureHistory[1] = 0;
+        captureHistory[2] = 0;
     }
 
     else if(mode == PWM)
     {
         rawInterruptStatusBit = ((use == timerB) ? 10 : 2);
+
+        //2. PWM mode only runs on the individual timers
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCFG_OFFSET)), 0x4, 0, 3, RW);
+
+        //3. Configure for PWM (TnAMS = 1), edge-count (TnCMR = 0) and periodic mode (TnMR = 0x2). PWM always counts down.
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), 0x2, 0, 2, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::clear, 2, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::set, 3, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::clear, 4, 1, RW);
+
+        //4. Glitch free updates, match (TnMRSU) and load (TnILD) are latched at the next timeout. 
+        //   TnPLO drives the CCP high on reload so the full 0% to 100% duty range is available.
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::set, 8, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::set, 10, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::set, 11, 1, RW);
+
+        //5. Output is not inverted, edge of the PWM output that generates the PWM interrupt
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), (uint32_t)setORClear::clear, ((use%2)*8) + 6, 1, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), event, ((use%2)*8) + 2, 2, RW);
+
+        //6. Period and an initial 0% duty cycle, the prescaler extends both to 24-bits for short and 48-bits for wide timers
+        pwmLoad = clockCycles;
+        pwmPrescaleMatch = (uint32_t)(pwmLoad >> (((block/6) == 0) ? 16 : 32));
+        setExtendedRegister(GPTMTnILR_OFFSET[(use%2)], GPTMTnPR_OFFSET[(use%2)], pwmLoad);
+        setExtendedRegister(GPTMTnMATCHR_OFFSET[(use%2)], GPTMTnPMR_OFFSET[(use%2)], pwmLoad);
     }
 
     clearInterrupt();
 
+    return(true);
 }
 
 /**
@@ -170,16 +293,47 @@ void GeneralPurposeTimer::initialize(timerMode mode, timerBlock block, uint32_t
  *        time capture, or PWM
  * @param block of the timer used. There are six A&B short timers and six A&B
  *        wide timers.
- * @param clockCycles period in clock ticks/cycles
+ * @param clockCycles period in clock ticks/cycles. Up to 64-bits for a
+ *        concatenated wide timer.
  * @param direction of the timer count
  * @param use of timer. Timer A, Timer B, or concatonated
- *  
+ * @return false if the period does not fit the timer, or the mode is not 
+ *         available on it, nothing is changed
  */
-void GeneralPurposeTimer::initializeForPolling(timerMode mode, timerBlock block, uint32_t clockCycles, countDirection dir, timerUse use, void (*action)(void))
+bool GeneralPurposeTimer::initializeForPolling(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, void (*action)(void))
 {
-    
+    return(initializeForPolling(mode, block, clockCycles, dir, use, positiveEdge, action));
+}
+
+/**
+ * @brief Initializes a timer in which the status of the timer is polled,
+ *        rather than an NVIC interrupt being generated. Used for the capture
+ *        modes where the edge of the CCP pin has to be chosen.
+ * 
+ * @param mode of the timer. Can be one-shot, periodic, RTC, input edge count,
+ *        time capture, or PWM
+ * @param block of the timer used. There are six A&B short timers and six A&B
+ *        wide timers.
+ * @param clockCycles period in clock ticks/cycles. In edge-count mode the 
+ *        number of edges to count before the match event. Unused in edge-time
+ *        mode where the full counter range is used. Up to 24-bits for a short
+ *        timer and 48-bits for a wide timer in PWM mode.
+ * @param direction of the timer count
+ * @param use of timer. Timer A, Timer B, or concatonated
+ * @param event edge of the CCP pin that generates a capture event
+ * @param action to be taken when the raw interrupt status is set
+ * @return false if the period does not fit the timer, or the mode is not 
+ *         available on it, nothing is changed
+ */
+bool GeneralPurposeTimer::initializeForPolling(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event, void (*action)(void))
+{
+    if(!initialize(mode, block, clockCycles, dir, use, event))
+    {
+        return(false);
+    }
+
     (*this).action = action;
-    initialize(mode, block, clockCycles, dir, use);
+    return(true);
 }
 
 /**
@@ -190,73 +344,90 @@ void GeneralPurposeTimer::initializeForPolling(timerMode mode, timerBlock block,
  *        time capture, or PWM
  * @param block of the timer used. There are six A&B short timers and six A&B
  *        wide timers.
- * @param clockCycles period in clock ticks/cycles
+ * @param clockCycles period in clock ticks/cycles. Up to 64-bits for a
+ *        concatenated wide timer.
  * @param direction of the timer count
  * @param use of timer. Timer A, Timer B, or concatonated
  * @param interuptPriority of the interrupt. Lower numbers have higher priority.
- *  
+ * @return false if the period does not fit the timer, or the mode is not 
+ *         available on it, nothing is changed
  */
-void GeneralPurposeTimer::initializeForInterupt(timerMode mode, timerBlock block, uint32_t clockCycles, countDirection dir, timerUse use, uint32_t interuptPriority)
+bool GeneralPurposeTimer::initializeForInterupt(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, uint32_t interuptPriority)
 {
-    initialize(mode, block, clockCycles, dir, use);
-    
-    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMIMR_OFFSET)), (uint32_t)setORClear::set, rawInterruptStatusBit, 1, RW);
-
-    switch (block)
-    {
-        case shortTimer0:
-            Nvic::activateInterrupt((use == timerB) ? _16_32_Bit_Timer_0B_Interrupt : _16_32_Bit_Timer_0A_Interrupt, interuptPriority);
-            break;
-
-        case shortTimer1:
-            Nvic::activateInterrupt((use == timerB) ? _16_32_Bit_Timer_1B_Interrupt : _16_32_Bit_Timer_1A_Interrupt, interuptPriority);
-            break;
-        
-        case shortTimer2:
-            Nvic::activateInterrupt((use == timerB) ? _16_32_Bit_Timer_2B_Interrupt : _16_32_Bit_Timer_2A_Interrupt, interuptPriority);
-            break;
-
-        case shortTimer3:
-            Nvic::activateInterrupt((use == timerB) ? _16_32_Bit_Timer_3B_Interrupt : _16_32_Bit_Timer_3A_Interrupt, interuptPriority);
-            break;
-
-        case shortTimer4:
-            Nvic::activateInterrupt((use == timerB) ? _16_32_Bit_Timer_4B_Interrupt : _16_32_Bit_Timer_4A_Interrupt, interuptPriority);
-            break;
-
-        case shortTimer5:
-            Nvic::activateInterrupt((use == timerB) ? _16_32_Bit_Timer_5B_Interrupt : _16_32_Bit_Timer_5A_Interrupt, interuptPriority);
-            break;
+    return(initializeForInterupt(mode, block, clockCycles, dir, use, positiveEdge, interuptPriority));
+}
 
-        case wideTimer0:
-            Nvic::activateInterrupt((use == timerB) ? _32_64_Bit_Timer_0B_Interrupt : _32_64_Bit_Timer_0A_Interrupt, interuptPriority);
-            break;
+/**
+ * @brief Initializes a timer in which an NVIC interrupt is generated and 
+ *        the status does not have to be constantly polled. Used for the
+ *        capture modes where the edge of the CCP pin has to be chosen.
+ * 
+ * @param mode of the timer. Can be one-shot, periodic, RTC, input edge count,
+ *        time capture, or PWM
+ * @param block of the timer used. There are six A&B short timers and six A&B
+ *        wide timers.
+ * @param clockCycles period in clock ticks/cycles. In edge-count mode the 
+ *        number of edges to count before the match event. Unused in edge-time
+ *        mode where the full counter range is used. Up to 24-bits for a short
+ *        timer and 48-bits for a wide timer in PWM mode.
+ * @param direction of the timer count
+ * @param use of timer. Timer A, Timer B, or concatonated
+ * @param event edge of the CCP pin that generates a capture event, or edge
+ *        of the PWM output that generates the PWM interrupt
+ * @param interuptPriority of the interrupt. Lower numbers have higher priority.
+ * @return false if the period does not fit the timer, or the mode is not 
+ *         available on it, nothing is changed
+ */
+bool GeneralPurposeTimer::initializeForInterupt(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event, uint32_t interuptPriority)
+{
+    return(initializeForInterupt(mode, block, clockCycles, dir, use, event, interuptPriority, nullptr, nullptr));
+}
 
-        case wideTimer1:
-            Nvic::activateInterrupt((use == timerB) ? _32_64_Bit_Timer_1B_Interrupt : _32_64_Bit_Timer_1A_Interrupt, interuptPriority);
-            break;
+/**
+ * @brief Initializes a timer in which an NVIC interrupt is generated and 
+ *        the status does not have to be constantly polled. The driver owns
+ *        the timer interrupt vector, clears the fired status bits and then
+ *        calls the callback with the context pointer.
+ * 
+ * @param mode of the timer. Can be one-shot, periodic, RTC, input edge count,
+ *        time capture, or PWM
+ * @param block of the timer used. There are six A&B short timers and six A&B
+ *        wide timers.
+ * @param clockCycles period in clock ticks/cycles. In edge-count mode the 
+ *        number of edges to count before the match event. Unused in edge-time
+ *        mode where the full counter range is used.
+ * @param direction of the timer count
+ * @param use of timer. Timer A, Timer B, or concatonated
+ * @param event edge of the CCP pin that generates a capture event, or edge
+ *        of the PWM output that generates the PWM interrupt
+ * @param interuptPriority of the interrupt. Lower numbers have higher priority.
+ * @param callback called from the interrupt, may be nullptr
+ * @param context passed to the callback
+ * @return false if the period does not fit the timer, or the mode is not 
+ *         available on it, nothing is changed
+ */
+bool GeneralPurposeTimer::initializeForInterupt(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event, uint32_t interuptPriority, void (*callback)(void*), void* context)
+{
+    if(!initialize(mode, block, clockCycles, dir, use, event))
+    {
+        return(false);
+    }
 
-        case wideTimer2:
-            Nvic::activateInterrupt((use == timerB) ? _32_64_Bit_Timer_2B_Interrupt : _32_64_Bit_Timer_2A_Interrupt, interuptPriority);
-            break;
+    (*this).callback = callback;
+    (*this).context = context;
+    registeredTimers[block][(use%2)] = this;
+    
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMIMR_OFFSET)), (uint32_t)setORClear::set, rawInterruptStatusBit, 1, RW);
 
-        case wideTimer3:
-            Nvic::activateInterrupt((use == timerB) ? _32_64_Bit_Timer_3B_Interrupt : _32_64_Bit_Timer_3A_Interrupt, interuptPriority);
-            break;
+    //PWM edge interrupts also have to be enabled in the mode register, TnPWMIE
+    if(mode == PWM)
+    {
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (uint32_t)setORClear::set, 9, 1, RW);
+    }
 
-        case wideTimer4:
-            Nvic::activateInterrupt((use == timerB) ? _32_64_Bit_Timer_4B_Interrupt : _32_64_Bit_Timer_4A_Interrupt, interuptPriority);
-            break;
+    Nvic::activateInterrupt(timerInterrupt[block][(use%2)], interuptPriority);
 
-        case wideTimer5:
-            Nvic::activateInterrupt((use == timerB) ? _32_64_Bit_Timer_5B_Interrupt : _32_64_Bit_Timer_5A_Interrupt, interuptPriority);
-            break;
-        
-        default:
-            Nvic::activateInterrupt(_16_32_Bit_Timer_0A_Interrupt, interuptPriority);
-            break;
-    }
-    
+    return(true);
 }
 
 
@@ -287,4 +458,544 @@ void GeneralPurposeTimer::clearInterrupt(void)
 void GeneralPurposeTimer::enableTimer(void)
 {
     Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), (uint32_t)setORClear::set, (use%2)*8, 1, RW);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Makes the timer wait for a trigger from the timer in the previous
+ *        position of the daisy chain before it starts counting, TnWOT. Used
+ *        to sequence one-shot timers. Has to be called after initialization
+ *        and before the timer is enabled.
+ * 
+ * @param wait true to wait on the trigger
+ */
+void GeneralPurposeTimer::setWaitOnTrigger(bool wait)
+{
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMTnMR_OFFSET[(use%2)])), (wait ? 0x1 : 0x0), 6, 1, RW);
+}
+
+/**
+ * @brief Gets the bits of this timer in the GPTMSYNC register. Masks of
+ *        several timers can be or'ed together and passed to 
+ *        \c synchronize.
+ * 
+ * @return GPTMSYNC mask of this timer
+ */
+uint32_t GeneralPurposeTimer::getSyncMask(void)
+{
+    uint32_t syncValue = ((use == concatenated) ? 0x3 : ((use == timerA) ? 0x1 : 0x2));
+
+    return(syncValue << (block*2));
+}
+
+/**
+ * @brief Resets every timer in the mask on the same clock cycle. Enabled
+ *        timers are reloaded and count from there, so they run aligned.
+ * 
+ * @details GPTMSYNC only exists in 16/32-bit Timer 0, so the clock for Timer 0
+ *          is enabled if it is not already.
+ * 
+ * @param syncMask or'ed masks from \c getSyncMask
+ */
+void GeneralPurposeTimer::synchronize(uint32_t syncMask)
+{
+    if(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + RCGCTIMER_OFFSET)), 0, 1, RW) == 0)
+    {
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + RCGCTIMER_OFFSET)), (uint32_t)setORClear::set, 0, 1, RW);
+        while(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + PRTIMER_OFFSET)), 0, 1, RO) == 0)
+        {
+            //Ready?
+        }
+    }
+
+    (*((volatile uint32_t*)(_16_32_bit_Timer_0_base + GPTMSYNC_OFFSET))) = syncMask;
+}
+
+/**
+ * @brief Enables a group of initialized timers and then resets all of them
+ *        at once through GPTMSYNC, removing the skew between the individual
+ *        enables.
+ * 
+ * @param timers to be started
+ * @param numberOfTimers in the timers array
+ */
+void GeneralPurposeTimer::startSynchronized(GeneralPurposeTimer* timers[], uint32_t numberOfTimers)
+{
+    uint32_t syncMask = 0;
+
+    for(uint32_t i = 0; i < numberOfTimers; i++)
+    {
+        syncMask = syncMask | (*timers[i]).getSyncMask();
+        (*timers[i]).enableTimer();
+    }
+
+    synchronize(syncMask);
+}
+
+/**
+ * @brief Reads the current free running value of the timer.
+ * 
+ * @details For a concatenated wide timer the upper half is read before and
+ *          after the lower half, and the read is repeated if the lower half
+ *          rolled over in between, so the 64-bit value is never torn.
+ * 
+ * @return current value of the timer in clock ticks.
+ */
+uint64_t GeneralPurposeTimer::getTimerValue(void)
+{
+    if((use == concatenated) && ((block/6) == 1))
+    {
+        uint32_t upper;
+        uint32_t lower;
+        uint32_t upperAgain;
+
+        do
+        {
+            upper = (*((volatile uint32_t*)(baseAddress + GPTMTBV_OFFSET)));
+            lower = (*((volatile uint32_t*)(baseAddress + GPTMTAV_OFFSET)));
+            upperAgain = (*((volatile uint32_t*)(baseAddress + GPTMTBV_OFFSET)));
+        } while(upper != upperAgain);
+
+        return((((uint64_t)upper) << 32) | lower);
+    }
+
+    else
+    {
+        return(*((volatile uint32_t*)(baseAddress + GPTMTnV_OFFSET[(use%2)])));
+    }
+}
+
+/**
+ * @brief Reads the timer value latched by the last capture event.
+ * 
+ * @details In edge-time mode short timers latch 24-bits, the upper 8 bits
+ *          being the prescaler. Wide timers latch 48-bits, the upper 16 bits
+ *          being read from the prescaler snapshot register.
+ * 
+ * @return the captured time stamp in clock ticks.
+ */
+uint64_t GeneralPurposeTimer::getCapture(void)
+{
+    if((block/6) == 0)
+    {
+        return((*((volatile uint32_t*)(baseAddress + GPTMTnR_OFFSET[(use%2)]))) & 0x00FFFFFF);
+    }
+
+    else
+    {
+        uint64_t upper = (*((volatile uint32_t*)(baseAddress + GPTMTnPS_OFFSET[(use%2)]))) & 0xFFFF;
+        return((upper << 32) | (*((volatile uint32_t*)(baseAddress + GPTMTnR_OFFSET[(use%2)]))));
+    }
+}
+
+/**
+ * @brief Reads the last capture and keeps it, along with the previous two
+ *        captures, for \c getPeriod and \c getPulseWidth. Should be called
+ *        once per capture event, from the polling action or interrupt.
+ * 
+ * @return the captured time stamp in clock ticks.
+ */
+uint64_t GeneralPurposeTimer::recordCapture(void)
+{
+    captureHistory[2] = captureHistory[1];
+    captureHistory[1] = captureHistory[0];
+    captureHistory[0] = getCapture();
+
+    return(captureHistory[0]);
+}
+
+/**
+ * @brief Computes the number of ticks between two captures, taking the
+ *        count direction and the wrap of the counter into account.
+ * 
+ * @param earlier capture time stamp
+ * @param later capture time stamp
+ * 
+ * @return ticks elapsed between \c earlier and \c later.
+ */
+uint64_t GeneralPurposeTimer::getElapsedTicks(uint64_t earlier, uint64_t later)
+{
+    uint64_t mask = (((block/6) == 0) ? 0x0000000000FFFFFF : 0x0000FFFFFFFFFFFF);
+
+    return(((dir == up) ? (later - earlier) : (earlier - later)) & mask);
+}
+
+/**
+ * @brief Period of the input signal in clock ticks, from the recorded
+ *        captures. With \c bothEdges two captures make up one period.
+ * 
+ * @return period of the input in clock ticks.
+ */
+uint64_t GeneralPurposeTimer::getPeriod(void)
+{
+    if(event == bothEdges)
+    {
+        return(getElapsedTicks(captureHistory[2], captureHistory[0]));
+    }
+
+    else
+    {
+        return(getElapsedTicks(captureHistory[1], captureHistory[0]));
+    }
+}
+
+/**
+ * @brief Width of the level that ended at the most recent capture, from the
+ *        recorded captures. Only meaningful when capturing \c bothEdges, 
+ *        reading the CCP pin tells if it was the high or the low time.
+ * 
+ * @return pulse width in clock ticks.
+ */
+uint64_t GeneralPurposeTimer::getPulseWidth(void)
+{
+    return(getElapsedTicks(captureHistory[1], captureHistory[0]));
+}
+
+/**
+ * @brief Address of the register the capture is latched in. Can be used as
+ *        the source address of a µDMA transfer that is requested on each
+ *        capture event.
+ * 
+ * @details The µDMA reads one 32-bit item per capture. That is the whole 
+ *          capture of a short timer, but only the lower 32-bits of a wide 
+ *          timer. The upper 16-bits stay in GPTMTnPS, which is not streamed,
+ *          so streamed wide timer captures wrap every 2^32 clock ticks.
+ * 
+ * @return address of GPTMTnR for this timer.
+ */
+volatile uint32_t* GeneralPurposeTimer::getCaptureAddress(void)
+{
+    return((volatile uint32_t*)(baseAddress + GPTMTnR_OFFSET[(use%2)]));
+}
+
+/**
+ * @brief Sets the duty cycle of a timer in PWM mode. The output is high from
+ *        the reload until the count reaches the match value.
+ * 
+ * @details The new match is latched at the next timeout so the output never
+ *          glitches. Unless the prescale match changes only a single store to
+ *          GPTMTnMATCHR is made, so it can be called at control loop rates.
+ * 
+ * @param highTicks high time of the output in clock ticks/cycles. Clamped to
+ *        the period.
+ */
+void GeneralPurposeTimer::setPwmDuty(uint64_t highTicks)
+{
+    uint64_t match = ((highTicks >= pwmLoad) ? 0 : (pwmLoad - highTicks));
+    uint32_t shift = (((block/6) == 0) ? 16 : 32);
+    uint32_t prescaleMatch = (uint32_t)(match >> shift);
+
+    if(prescaleMatch != pwmPrescaleMatch)
+    {
+        (*((volatile uint32_t*)(baseAddress + GPTMTnPMR_OFFSET[(use%2)]))) = prescaleMatch;
+        pwmPrescaleMatch = prescaleMatch;
+    }
+
+    (*((volatile uint32_t*)(baseAddress + GPTMTnMATCHR_OFFSET[(use%2)]))) = (uint32_t)(match & ((((uint64_t)1) << shift) - 1));
+}
+
+/**
+ * @brief Inverts the PWM output of a timer in PWM mode, TnPWML.
+ * 
+ * @param invert true for an inverted (active low) output
+ */
+void GeneralPurposeTimer::invertPwmOutput(bool invert)
+{
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + GPTMCTL_OFFSET)), (invert ? 0x1 : 0x0), ((use%2)*8) + 6, 1, RW);
+}
+
+/**
+ * @brief Sets the seconds count of a timer in RTC mode.
+ * 
+ * @param seconds new seconds count
+ */
+void GeneralPurposeTimer::setRtcSeconds(uint32_t seconds)
+{
+    (*((volatile uint32_t*)(baseAddress + GPTMTAV_OFFSET))) = seconds;
+}
+
+/**
+ * @brief Gets the seconds count of a timer in RTC mode.
+ * 
+ * @return seconds counted
+ */
+uint32_t GeneralPurposeTimer::getRtcSeconds(void)
+{
+    return(*((volatile uint32_t*)(baseAddress + GPTMTAV_OFFSET)));
+}
+
+/**
+ * @brief Gets the fraction of the current second of a timer in RTC mode from
+ *        the RTC predivider, GPTMRTCPD.
+ * 
+ * @details The predivider counts down from 0x7FFF every second. The seconds
+ *          count is read before and after the predivider and the read is 
+ *          repeated if a second elapsed in between.
+ * 
+ * @param seconds set to the seconds count that matches the subseconds, may
+ *        be nullptr
+ * @return subseconds in 1/32768 second units
+ */
+uint32_t GeneralPurposeTimer::getRtcSubseconds(uint32_t* seconds)
+{
+    uint32_t secondsBefore;
+    uint32_t predivider;
+    uint32_t secondsAfter;
+
+    do
+    {
+        secondsBefore = (*((volatile uint32_t*)(baseAddress + GPTMTAV_OFFSET)));
+        predivider = (*((volatile uint32_t*)(baseAddress + GPTMRTCPD_OFFSET))) & 0x7FFF;
+        secondsAfter = (*((volatile uint32_t*)(baseAddress + GPTMTAV_OFFSET)));
+    } while(secondsBefore != secondsAfter);
+
+    if(seconds != nullptr)
+    {
+        (*seconds) = secondsAfter;
+    }
+
+    return(0x7FFF - predivider);
+}
+
+/**
+ * @brief Sets the alarm of a timer in RTC mode. The RTC status is raised,
+ *        and the interrupt generated when initialized for interrupts, when
+ *        the seconds count reaches the alarm.
+ * 
+ * @param seconds count at which the alarm goes off
+ */
+void GeneralPurposeTimer::setRtcAlarm(uint32_t seconds)
+{
+    (*((volatile uint32_t*)(baseAddress + GPTMTAMATCHR_OFFSET))) = seconds;
+    clearInterrupt();
+}
+
+/**
+ * @brief Allocates a µDMA channel for the timer. Concatenated timers use 
+ *        the timer A request.
+ * 
+ * @param dma channel to be initialized for this timer
+ * @return false if every channel of the timer is in use by another driver
+ */
+bool GeneralPurposeTimer::attachDma(Dma* dma)
+{
+    return((*dma).allocate(timerDmaPeripheral[block][(use%2)]));
+}
+
+/**
+ * @brief Moves one item from a table to a peripheral register on every
+ *        timer event. The timer has to be initialized, the channel attached
+ *        with \c attachDma, and the timer enabled to start the stream. The
+ *        channel stops once the whole table has been moved.
+ * 
+ * @param dma channel attached to this timer
+ * @param table of items in SRAM, incremented by the item size
+ * @param destination peripheral register, not incremented
+ * @param size of each item
+ * @param numberOfItems in the table, 1 to 1024
+ * @return false if the channel was not attached or the table is in flash, 
+ *         which the µDMA can not read, nothing is started
+ */
+bool GeneralPurposeTimer::startDmaStream(Dma* dma, const volatile void* table, volatile void* destination, dmaDataSize size, uint32_t numberOfItems)
+{
+    if(!(*dma).isAllocated() || !Dma::reachable((uint32_t)(uintptr_t)table))
+    {
+        return(false);
+    }
+
+    (*dma).transfer(dmaTransferMode::basic, table, (dmaIncrement)size, destination, dmaIncrement::none, size, numberOfItems, dmaArbitrationSize::_1);
+    (*dma).enable();
+
+    return(true);
+}
+
+/**
+ * @brief Enables the timer vector for the completion interrupt of the µDMA
+ *        channel of the timer. The callback is called when a transfer 
+ *        completes, it has to clear the completion status of the channel
+ *        with \c Dma::clearComplete. The timer can be initialized for 
+ *        polling, no timer interrupt is unmasked.
+ * 
+ * @param interuptPriority of the interrupt. Lower numbers have higher priority.
+ * @param callback called from the interrupt, may be nullptr
+ * @param context passed to the callback
+ */
+void GeneralPurposeTimer::enableDmaInterrupt(uint32_t interuptPriority, void (*callback)(void*), void* context)
+{
+    (*this).callback = callback;
+    (*this).context = context;
+    registeredTimers[block][(use%2)] = this;
+
+    Nvic::activateInterrupt(timerInterrupt[block][(use%2)], interuptPriority);
+}
+
+/**
+ * @brief Writes a value to a register that is extended by the prescaler. The
+ *        prescaler holds bits 23:16 for a short timer and bits 47:32 for a
+ *        wide timer.
+ * 
+ * @param registerOffset of the interval load or match register
+ * @param prescaleOffset of the matching prescale or prescale match register
+ * @param value to be written across both registers
+ */
+void GeneralPurposeTimer::setExtendedRegister(uint32_t registerOffset, uint32_t prescaleOffset, uint64_t value)
+{
+    if((block/6) == 0)
+    {
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + registerOffset)), (uint32_t)(value & 0xFFFF), 0, 16, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + prescaleOffset)), (uint32_t)((value >> 16) & 0xFF), 0, 8, RW);
+    }
+
+    else
+    {
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + registerOffset)), (uint32_t)(value & 0xFFFFFFFF), 0, 32, RW);
+        Register::setRegisterBitFieldStatus(((volatile uint32_t*)(baseAddress + prescaleOffset)), (uint32_t)((value >> 32) & 0xFFFF), 0, 16, RW);
+    }
+}
+
+/**
+ * @brief Services a timer interrupt. Clears only the status bits that fired,
+ *        read from GPTMMIS, and calls the callback of the registered timer.
+ *        Called from the timer interrupt vectors.
+ * 
+ * @param block of the timer that interrupted
+ * @param use timer A or timer B vector. Concatenated timers use timer A.
+ */
+void GeneralPurposeTimer::dispatch(timerBlock block, timerUse use)
+{
+    GeneralPurposeTimer* timer = registeredTimers[block][use];
+
+    if(timer == nullptr)
+    {
+        return;
+    }
+
+    uint32_t baseAddress = timerBaseAddresses[block];
+    uint32_t firedStatus = (*((volatile uint32_t*)(baseAddress + GPTMMIS_OFFSET))) & ((use == timerB) ? 0x00000F00 : 0x0000001F);
+
+    (*((volatile uint32_t*)(baseAddress + GPTMICR_OFFSET))) = firedStatus;
+
+    if((*timer).callback != nullptr)
+    {
+        (*timer).callback((*timer).context);
+    }
+}
+
+extern "C" void _16_32_Bit_Timer_0A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer0, timerA);
+}
+
+extern "C" void _16_32_Bit_Timer_0B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer0, timerB);
+}
+
+extern "C" void _16_32_Bit_Timer_1A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer1, timerA);
+}
+
+extern "C" void _16_32_Bit_Timer_1B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer1, timerB);
+}
+
+extern "C" void _16_32_Bit_Timer_2A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer2, timerA);
+}
+
+extern "C" void _16_32_Bit_Timer_2B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer2, timerB);
+}
+
+extern "C" void _16_32_Bit_Timer_3A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer3, timerA);
+}
+
+extern "C" void _16_32_Bit_Timer_3B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer3, timerB);
+}
+
+extern "C" void _16_32_Bit_Timer_4A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer4, timerA);
+}
+
+extern "C" void _16_32_Bit_Timer_4B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer4, timerB);
+}
+
+extern "C" void _16_32_Bit_Timer_5A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer5, timerA);
+}
+
+extern "C" void _16_32_Bit_Timer_5B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(shortTimer5, timerB);
+}
+
+extern "C" void _32_64_Bit_Timer_0A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer0, timerA);
+}
+
+extern "C" void _32_64_Bit_Timer_0B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer0, timerB);
+}
+
+extern "C" void _32_64_Bit_Timer_1A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer1, timerA);
+}
+
+extern "C" void _32_64_Bit_Timer_1B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer1, timerB);
+}
+
+extern "C" void _32_64_Bit_Timer_2A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer2, timerA);
+}
+
+extern "C" void _32_64_Bit_Timer_2B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer2, timerB);
+}
+
+extern "C" void _32_64_Bit_Timer_3A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer3, timerA);
+}
+
+extern "C" void _32_64_Bit_Timer_3B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer3, timerB);
+}
+
+extern "C" void _32_64_Bit_Timer_4A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer4, timerA);
+}
+
+extern "C" void _32_64_Bit_Timer_4B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer4, timerB);
+}
+
+extern "C" void _32_64_Bit_Timer_5A_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer5, timerA);
+}
+
+extern "C" void _32_64_Bit_Timer_5B_Handler(void)
+{
+    GeneralPurposeTimer::dispatch(wideTimer5, timerB);
+}
@@ -69,6 +69,76 @@
  * few fixed values (powers of 2), or they may be any integer value from 1 to 
  * 2^P, where P is the number of prescaler bits.
  * 
+ * When a wide timer block is used in concatenated mode the full 64-bit period
+ * can be given to \c initializeForPolling and \c initializeForInterupt. The
+ * interval load is split across GPTMTAILR (lower 32 bits) and GPTMTBILR (upper
+ * 32 bits), and \c getTimerValue returns the 64-bit count without tearing.
+ * 
+ * In input edge-time mode (\c edgeTime) the timer free runs over its full
+ * range, 24-bits for a short timer and 48-bits for a wide timer with the
+ * prescaler used as a timer extension, and the hardware latches the count on
+ * every selected edge of the CCP pin. \c getCapture reads the latched value.
+ * \c recordCapture additionally keeps the last three captures so that
+ * \c getPeriod and \c getPulseWidth can be computed in hardware ticks. The
+ * timer raises its µDMA burst request on every capture, \c getCaptureAddress
+ * gives the source address for streaming captures to memory. The µDMA moves
+ * at most 32-bits per request, so a streamed capture holds the full 24-bit 
+ * count of a short timer but only the lower 32-bits of a wide timer, the 
+ * upper 16-bits of the prescaler snapshot are not streamed. Streamed wide 
+ * timer captures wrap every 2^32 clock ticks, about 53s at 80MHz, and
+ * differences between them have to be taken modulo 2^32.
+ * 
+ * In input edge-count mode (\c edgeCount) the timer counts edges of the CCP
+ * pin in hardware and only raises the match interrupt once the number of 
+ * edges passed as \c clockCycles has been counted, up to 24-bits on a short
+ * timer and 48-bits on a wide timer. When counting down the timer stops at the
+ * match, \c enableTimer re-arms it for the next batch of edges.
+ * 
+ * In PWM mode (\c PWM) any \c TnCCPn or \c WTnCCPn pin can be used as an
+ * additional PWM output. The timer counts down from \c clockCycles, the 
+ * output is high from the reload until the match. \c setPwmDuty updates the
+ * match, which the hardware latches at the next timeout so the output never
+ * glitches. In interrupt mode the \c timerEvent selects the PWM output edge
+ * that generates the interrupt.
+ * 
+ * \c startSynchronized enables a group of timers and resets them on the same
+ * clock cycle through the GPTMSYNC register of Timer 0, so timebases of 
+ * several timers stay aligned. \c setWaitOnTrigger (TnWOT) holds a timer 
+ * until the previous timer in the daisy chain times out, which sequences 
+ * one-shot timers without software.
+ * 
+ * The driver provides all 24 timer interrupt vectors. A timer initialized
+ * with \c initializeForInterupt is registered to its vector, the vector 
+ * clears only the status bits that fired (GPTMMIS) and calls the callback
+ * with the context pointer given at initialization. The application must not
+ * define the timer handlers itself.
+ * 
+ * In RTC mode (\c realTimeClock) a concatenated short timer counts seconds
+ * from a 32.768 kHz clock applied to its even CCP pin (TnCCP0), for example 
+ * from the crystal of the hibernation module routed externally. The timer can
+ * keep counting while the PLL clocked timers are stopped. \c setRtcAlarm 
+ * loads the match for an alarm interrupt and \c getRtcSubseconds reads the 
+ * fraction of the second from the RTC predivider.
+ * 
+ * Every timer has a dedicated µDMA channel that requests a transfer on each
+ * timer event, a timeout in one-shot and periodic mode. \c startDmaStream
+ * moves the next item of a table into a peripheral register on every 
+ * timeout, PWM compare, GPIODATA or SSI data for example, which generates 
+ * waveforms or bit patterns at precise intervals without the CPU. The 
+ * µDMA can only read SRAM and the peripherals, a \c const table must not be
+ * placed in flash and \c startDmaStream refuses one that is. The µDMA 
+ * completion interrupt of the channel is raised on the timer vector, 
+ * \c enableDmaInterrupt registers a callback for it.
+ * 
+ * Individual timers use the prescaler in one-shot and periodic mode, so a 
+ * 16-bit half of a short timer reaches 24-bit periods (about 210 ms at 
+ * 80 MHz) instead of 16-bit periods. Counting down the prescaler divides 
+ * the clock, so a period longer than the interval load is rounded down to
+ * a multiple of the prescale, \c achievedClockCycles gives the period 
+ * actually reached. Counting up the prescaler extends the count and the 
+ * period is exact. \c TimerPeriod and \c TimerFrequency compute the clock
+ * ticks/cycles from physical units at compile time.
+ * 
  * For more detailed information on the General Purpose Timer please see page 704 of the 
  * TM4C123GH6PM datasheet @ https://www.ti.com/lit/ds/symlink/tm4c123gh6pm.pdf
  * 
@@ -93,6 +163,7 @@
 #define GENERAL_PURPOSE_TIMER_H
 
 #include "../systemControl/systemControl.h"
+#include "../udma/udma.h"
 
 /**
  * Mode of the timer.
@@ -127,6 +198,14 @@ enum timerUse
     timerA, timerB, concatenated
 };
 
+/**
+ * Edge of the CCP input that generates a capture or count event.
+ */
+enum timerEvent
+{
+    positiveEdge = 0x0, negativeEdge = 0x1, bothEdges = 0x3
+};
+
 
 class GeneralPurposeTimer
 {
@@ -134,19 +213,118 @@ class GeneralPurposeTimer
         GeneralPurposeTimer();
         ~GeneralPurposeTimer();
 
-        void initializeForPolling(timerMode mode, timerBlock block, uint32_t clockCycles, countDirection dir, timerUse use, void (*action)(void));
-        void initializeForInterupt(timerMode mode, timerBlock block, uint32_t clockCycles, countDirection dir, timerUse use, uint32_t interuptPriority);
+        bool initializeForPolling(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, void (*action)(void));
+        bool initializeForInterupt(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, uint32_t interuptPriority);
+        bool initializeForPolling(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event, void (*action)(void));
+        bool initializeForInterupt(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event, uint32_t interuptPriority);
+        bool initializeForInterupt(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event, uint32_t interuptPriority, void (*callback)(void*), void* context);
 
         void pollStatus(void);
         void clearInterrupt(void);
         void enableTimer(void);
+        void setWaitOnTrigger(bool wait);
+        uint32_t getSyncMask(void);
+
+        static void synchronize(uint32_t syncMask);
+        static void startSynchronized(GeneralPurposeTimer* timers[], uint32_t numberOfTimers);
+        static void dispatch(timerBlock block, timerUse use);
+
+        /**
+         * @brief Largest period in clock ticks/cycles a timer can reach with
+         *        the prescaler. 24-bits for an individual short timer, 
+         *        32-bits for a concatenated short timer, 48-bits for an
+         *        individual wide timer and 64-bits for a concatenated wide
+         *        timer.
+         * 
+         * @param block of the timer
+         * @param use of timer. Timer A, Timer B, or concatonated
+         * @return largest period in clock ticks/cycles
+         */
+        static constexpr uint64_t maximumClockCycles(timerBlock block, timerUse use)
+        {
+            return(((block/6) == 0) ? ((use == concatenated) ? 0x0000000100000000 : 0x0000000001000000) : ((use == concatenated) ? 0xFFFFFFFFFFFFFFFF : 0x0001000000000000));
+        }
+
+        /**
+         * @brief Prescaler value that divides a period down into the interval
+         *        load of an individual timer counting down.
+         * 
+         * @param clockCycles period in clock ticks/cycles
+         * @param block of the timer
+         * @return GPTMTnPR value
+         */
+        static constexpr uint32_t prescaleFor(uint64_t clockCycles, timerBlock block)
+        {
+            return((uint32_t)((clockCycles - 1) >> (((block/6) == 0) ? 16 : 32)));
+        }
+
+        /**
+         * @brief Interval load of an individual timer counting down once the
+         *        clock is divided by the prescaler. The division is rounded 
+         *        down.
+         * 
+         * @param clockCycles period in clock ticks/cycles
+         * @param block of the timer
+         * @return GPTMTnILR value
+         */
+        static constexpr uint64_t loadFor(uint64_t clockCycles, timerBlock block)
+        {
+            return((clockCycles/(prescaleFor(clockCycles, block) + 1)) - 1);
+        }
+
+        /**
+         * @brief Period reached by a timer counting down. An individual timer
+         *        counts (prescale + 1) * (load + 1) clock ticks/cycles, which 
+         *        is short of the period asked for by less than the prescale
+         *        when the period is not a multiple of it. Concatenated timers
+         *        and timers counting up reach the period exactly.
+         * 
+         * @param clockCycles period in clock ticks/cycles
+         * @param block of the timer
+         * @param use of timer. Timer A, Timer B, or concatonated
+         * @return period reached in clock ticks/cycles
+         */
+        static constexpr uint64_t achievedClockCycles(uint64_t clockCycles, timerBlock block, timerUse use)
+        {
+            return((use == concatenated) ? clockCycles : (((uint64_t)prescaleFor(clockCycles, block) + 1) * (loadFor(clockCycles, block) + 1)));
+        }
+
+        uint64_t getTimerValue(void);
+
+        uint64_t getCapture(void);
+        uint64_t recordCapture(void);
+        uint64_t getElapsedTicks(uint64_t earlier, uint64_t later);
+        uint64_t getPeriod(void);
+        uint64_t getPulseWidth(void);
+        volatile uint32_t* getCaptureAddress(void);
+
+        void setPwmDuty(uint64_t highTicks);
+        void invertPwmOutput(bool invert);
+
+        void setRtcSeconds(uint32_t seconds);
+        uint32_t getRtcSeconds(void);
+        uint32_t getRtcSubseconds(uint32_t* seconds);
+        void setRtcAlarm(uint32_t seconds);
+
+        bool attachDma(Dma* dma);
+        bool startDmaStream(Dma* dma, const volatile void* table, volatile void* destination, dmaDataSize size, uint32_t numberOfItems);
+        void enableDmaInterrupt(uint32_t interuptPriority, void (*callback)(void*), void* context);
 
     private:
 
-        void initialize(timerMode mode, timerBlock block, uint32_t clockCycles, countDirection dir, timerUse use);
+        bool initialize(timerMode mode, timerBlock block, uint64_t clockCycles, countDirection dir, timerUse use, timerEvent event);
+        void setExtendedRegister(uint32_t registerOffset, uint32_t prescaleOffset, uint64_t value);
 
         void (*action)(void);
+        void (*callback)(void*);
+        void* context;
         timerUse use;
+        timerBlock block;
+        countDirection dir;
+        timerEvent event;
+        uint64_t captureHistory[3];
+        uint64_t pwmLoad;
+        uint32_t pwmPrescaleMatch;
         uint32_t rawInterruptStatusBit;
         uint32_t baseAddress;
 
@@ -166,6 +344,18 @@ class GeneralPurposeTimer
 
         static const uint32_t timerBaseAddresses[12];
 
+        static GeneralPurposeTimer* registeredTimers[12][2];
+
+        static const dmaPeripheral timerDmaPeripheral[12][2];
+
+        static constexpr interrupt timerInterrupt[12][2] = {
+            {_16_32_Bit_Timer_0A_Interrupt, _16_32_Bit_Timer_0B_Interrupt}, {_16_32_Bit_Timer_1A_Interrupt, _16_32_Bit_Timer_1B_Interrupt},
+            {_16_32_Bit_Timer_2A_Interrupt, _16_32_Bit_Timer_2B_Interrupt}, {_16_32_Bit_Timer_3A_Interrupt, _16_32_Bit_Timer_3B_Interrupt},
+            {_16_32_Bit_Timer_4A_Interrupt, _16_32_Bit_Timer_4B_Interrupt}, {_16_32_Bit_Timer_5A_Interrupt, _16_32_Bit_Timer_5B_Interrupt},
+            {_32_64_Bit_Timer_0A_Interrupt, _32_64_Bit_Timer_0B_Interrupt}, {_32_64_Bit_Timer_1A_Interrupt, _32_64_Bit_Timer_1B_Interrupt},
+            {_32_64_Bit_Timer_2A_Interrupt, _32_64_Bit_Timer_2B_Interrupt}, {_32_64_Bit_Timer_3A_Interrupt, _32_64_Bit_Timer_3B_Interrupt},
+            {_32_64_Bit_Timer_4A_Interrupt, _32_64_Bit_Timer_4B_Interrupt}, {_32_64_Bit_Timer_5A_Interrupt, _32_64_Bit_Timer_5B_Interrupt}};
+
         static const uint32_t PPTIMER_OFFSET = 0x304; //0x304 PPTIMER RO 0x0000.003F 16/32-Bit General-Purpose Timer Peripheral Present 288
         static const uint32_t SRTIMER_OFFSET = 0x504; //0x504 SRTIMER RW 0x0000.0000 16/32-Bit General-Purpose Timer Software Reset 312
         static const uint32_t RCGCTIMER_OFFSET = 0x604; //0x604 RCGCTIMER RW 0x0000.0000 16/32-Bit General-Purpose Timer Run Mode Clock Gating Control 338
@@ -0,0 +1,120 @@
+/**
+ * @file monotonicClock.cpp
+ * @brief TM4C123GH6PM Monotonic Clock Definition
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ * 
+ */
+
+#include "monotonicClock.h"
+
+GeneralPurposeTimer MonotonicClock::timer;
+uint32_t MonotonicClock::clockFrequency = 0;
+
+/**
+ * @brief empty constructor placeholder
+ */
+MonotonicClock::MonotonicClock()
+{
+
+}
+
+/**
+ * @brief empty deconstructor placeholder
+ */
+MonotonicClock::~MonotonicClock()
+{
+
+}
+
+/**
+ * @brief Starts the free running 64-bit counter used as the system timestamp
+ *        source.
+ * 
+ * @param block wide timer block to dedicate to the monotonic clock. Must be
+ *        one of \c wideTimer0 to \c wideTimer5.
+ * @param systemClockFrequency frequency of the system clock in Hz. Used to
+ *        convert cycles into nanoseconds. 0, the default, uses 
+ *        \c SystemControl::getClockFrequency.
+ * 
+ * @return false if the block is not a wide timer, the clock is not started.
+ */
+bool MonotonicClock::initialize(timerBlock block, uint32_t systemClockFrequency)
+{
+    if(block < wideTimer0)
+    {
+        return(false);
+    }
+
+    if(systemClockFrequency == 0)
+    {
+        systemClockFrequency = SystemControl::getClockFrequency();
+    }
+
+    if(!timer.initializeForPolling(periodic, block, UINT64_MAX, up, concatenated, nullptr))
+    {
+        return(false);
+    }
+
+    clockFrequency = systemClockFrequency;
+    timer.enableTimer();
+
+    return(true);
+}
+
+/**
+ * @return system clock cycles elapsed since \c initialize was called.
+ */
+uint64_t MonotonicClock::now(void)
+{
+    return(timer.getTimerValue());
+}
+
+/**
+ * @return nanoseconds elapsed since \c initialize was called.
+ */
+uint64_t MonotonicClock::nowNanoseconds(void)
+{
+    return(cyclesToNanoseconds(timer.getTimerValue()));
+}
+
+/**
+ * @brief Converts a number of system clock cycles into nanoseconds.
+ * 
+ * @details Whole seconds and the remainder are scaled separately so the
+ *          intermediate product does not overflow 64-bits.
+ * 
+ * @param cycles number of system clock cycles.
+ * 
+ * @return the cycles in nanoseconds, or 0 if the clock was never initialized.
+ */
+uint64_t MonotonicClock::cyclesToNanoseconds(uint64_t cycles)
+{
+    if(clockFrequency == 0)
+    {
+        return(0);
+    }
+
+    return(((cycles / clockFrequency) * nanosecondsPerSecond) + (((cycles % clockFrequency) * nanosecondsPerSecond) / clockFrequency));
+}
@@ -0,0 +1,74 @@
+/**
+ * @file monotonicClock.h
+ * @brief TM4C123GH6PM Monotonic Clock Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class MonotonicClock
+ * @brief System wide high resolution timestamp source
+ * 
+ * @section monotonicClockDescription Monotonic Clock Description
+ * 
+ * The monotonic clock runs one of the 32/64-bit wide timer blocks as a free
+ * running 64-bit up counter clocked from the system clock. At 80MHz the
+ * counter has a resolution of 12.5ns and takes over 7000 years to wrap, so it
+ * never wraps in practice. Timestamps can be read in system clock cycles with
+ * \c now or converted to nanoseconds with \c nowNanoseconds.
+ * 
+ * Only one monotonic clock exists in the system. \c initialize must be called
+ * once, after the system clock has been configured, before any timestamps are
+ * read. By default the clock frequency is taken from 
+ * \c SystemControl::getClockFrequency. \c initialize returns false, and the
+ * clock is left stopped, if the block given is not a wide timer.
+ * 
+ */
+
+#ifndef MONOTONIC_CLOCK_H
+#define MONOTONIC_CLOCK_H
+
+#include "generalPurposeTimer.h"
+
+class MonotonicClock
+{
+    public:
+        MonotonicClock();
+        ~MonotonicClock();
+
+        static bool initialize(timerBlock block, uint32_t systemClockFrequency = 0);
+
+        static uint64_t now(void);
+        static uint64_t nowNanoseconds(void);
+        static uint64_t cyclesToNanoseconds(uint64_t cycles);
+
+    private:
+
+        static GeneralPurposeTimer timer;
+        static uint32_t clockFrequency;
+
+        static const uint64_t nanosecondsPerSecond = 1000000000;
+};
+
+#endif //MONOTONIC_CLOCK_H
@@ -0,0 +1,99 @@
+/**
+ * @file timerPeriod.h
+ * @brief TM4C123GH6PM Timer Period and Frequency Compile Time Conversion
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class TimerPeriod
+ * @brief Converts a period in nanoseconds to timer clock ticks/cycles at
+ *        compile time.
+ * 
+ * @section timerPeriodDescription Timer Period Description
+ * 
+ * The period is converted for a known system clock and checked against the
+ * range of the timer it is meant for with a \c static_assert, so a period a
+ * timer can not reach fails to compile rather than silently not being 
+ * written. The result is given to \c GeneralPurposeTimer::initializeForPolling
+ * or \c GeneralPurposeTimer::initializeForInterupt, which splits it between
+ * the interval load and the prescaler.
+ * 
+ * Counting down, an individual timer divides the clock by the prescaler and
+ * the period is rounded down to a multiple of it. \c prescale and \c load
+ * are the register values and \c achievedClockCycles the period reached,
+ * \c TimerPeriod<_80MHz, 100000000, shortTimer0, timerA> for example 
+ * reaches 7,999,920 cycles for 8,000,000. Compare it with \c clockCycles 
+ * in a \c static_assert where the error matters, or count up or use a 
+ * concatenated timer, which reach \c clockCycles exactly.
+ * 
+ * @code
+ * myTimer.initializeForPolling(periodic, shortTimer0, TimerPeriod<_80MHz, 100000000, shortTimer0, timerA>::clockCycles, down, timerA, action);
+ * @endcode
+ * 
+ * @class TimerFrequency
+ * @brief Converts a frequency in Hz to timer clock ticks/cycles at compile
+ *        time, with the same range checks and achieved period as 
+ *        \c TimerPeriod.
+ */
+
+#ifndef TIMER_PERIOD_H
+#define TIMER_PERIOD_H
+
+#include "generalPurposeTimer.h"
+
+template<SYSDIV2 clock, uint64_t nanoseconds, timerBlock block, timerUse use>
+class TimerPeriod
+{
+    private:
+        static const uint64_t nanosecondsPerSecond = 1000000000;
+
+    public:
+        static constexpr uint64_t clockCycles = ((nanoseconds/nanosecondsPerSecond)*SystemControl::clockFrequency(clock)) + (((nanoseconds%nanosecondsPerSecond)*SystemControl::clockFrequency(clock))/nanosecondsPerSecond);
+
+        static_assert(clockCycles >= 1, "period is shorter than one clock cycle");
+        static_assert(clockCycles <= GeneralPurposeTimer::maximumClockCycles(block, use), "period can not be reached by this timer, use a concatenated or wide timer");
+
+        static constexpr uint32_t prescale = (use == concatenated) ? 0 : GeneralPurposeTimer::prescaleFor((clockCycles >= 1) ? clockCycles : 1, block);
+        static constexpr uint64_t load = (use == concatenated) ? (clockCycles - 1) : GeneralPurposeTimer::loadFor((clockCycles >= 1) ? clockCycles : 1, block);
+        static constexpr uint64_t achievedClockCycles = GeneralPurposeTimer::achievedClockCycles((clockCycles >= 1) ? clockCycles : 1, block, use);
+};
+
+template<SYSDIV2 clock, uint32_t hertz, timerBlock block, timerUse use>
+class TimerFrequency
+{
+    static_assert(hertz >= 1, "frequency has to be at least 1 Hz");
+
+    public:
+        static constexpr uint64_t clockCycles = SystemControl::clockFrequency(clock)/((hertz >= 1) ? hertz : 1);
+
+        static_assert(clockCycles >= 1, "frequency is higher than the system clock");
+        static_assert(clockCycles <= GeneralPurposeTimer::maximumClockCycles(block, use), "frequency can not be reached by this timer, use a concatenated or wide timer");
+
+        static constexpr uint32_t prescale = (use == concatenated) ? 0 : GeneralPurposeTimer::prescaleFor((clockCycles >= 1) ? clockCycles : 1, block);
+        static constexpr uint64_t load = (use == concatenated) ? (clockCycles - 1) : GeneralPurposeTimer::loadFor((clockCycles >= 1) ? clockCycles : 1, block);
+        static constexpr uint64_t achievedClockCycles = GeneralPurposeTimer::achievedClockCycles((clockCycles >= 1) ? clockCycles : 1, block, use);
+};
+
+#endif //TIMER_PERIOD_H
@@ -0,0 +1,288 @@
+/**
+ * @file dmaMemory.cpp
+ * @brief TM4C123GH6PM µDMA Memory Copy and Fill Definition
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+#include <cstring>
+#include "dmaMemory.h"
+
+Dma DmaMemory::channel;
+
+volatile bool DmaMemory::busy = false;
+
+uint32_t DmaMemory::destinationAddress = 0;
+uint32_t DmaMemory::sourceAddress = 0;
+uint32_t DmaMemory::remainingItems = 0;
+dmaDataSize DmaMemory::itemSize = dmaDataSize::_8Bit;
+bool DmaMemory::fillMode = false;
+volatile uint32_t DmaMemory::fillPattern = 0;
+
+void (*DmaMemory::callback)(void*) = nullptr;
+void* DmaMemory::context = nullptr;
+
+/**
+ * @brief empty constructor placeholder
+ */
+DmaMemory::DmaMemory()
+{
+
+}
+
+/**
+ * @brief empty deconstructor placeholder
+ */
+DmaMemory::~DmaMemory()
+{
+
+}
+
+/**
+ * @brief Initializes the software channel and its completion interrupt.
+ * 
+ * @param interruptPriority of the µDMA software interrupt. Lower numbers 
+ *        have higher priority.
+ * @return false if no software channel is free, every block is then 
+ *         handled by the CPU
+ */
+bool DmaMemory::initialize(uint32_t interruptPriority)
+{
+    if(!channel.allocate(dmaPeripheral::software))
+    {
+        return(false);
+    }
+
+    Nvic::activateInterrupt(uDMA_Software_Interrupt, interruptPriority);
+    return(true);
+}
+
+/**
+ * @brief Copies a block of memory and waits for it to finish. Waits for an
+ *        asynchronous transfer in progress first. The chunks are chained by
+ *        the µDMA software interrupt, so it can not be called from an 
+ *        interrupt of the same or a higher priority.
+ * 
+ * @param destination of the copy
+ * @param source of the copy, a source in flash is copied by the CPU
+ * @param bytes to copy
+ */
+void DmaMemory::copy(void* destination, const void* source, uint32_t bytes)
+{
+    while(busy)
+    {
+        //Wait for the transfer in progress
+    }
+
+    start(destination, source, false, bytes, nullptr, nullptr);
+
+    while(busy)
+    {
+        //Wait
+    }
+}
+
+/**
+ * @brief Fills a block of memory with a byte and waits for it to finish.
+ *        Waits for an asynchronous transfer in progress first. Can not be 
+ *        called from an interrupt of the same or a higher priority than the
+ *        µDMA software interrupt.
+ * 
+ * @param destination of the fill
+ * @param value of every byte
+ * @param bytes to fill
+ */
+void DmaMemory::set(void* destination, uint8_t value, uint32_t bytes)
+{
+    while(busy)
+    {
+        //Wait for the transfer in progress
+    }
+
+    fillPattern = (uint32_t)value * 0x01010101;
+    start(destination, (const void*)&fillPattern, true, bytes, nullptr, nullptr);
+
+    while(busy)
+    {
+        //Wait
+    }
+}
+
+/**
+ * @brief Starts copying a block of memory and returns right away. Small 
+ *        blocks are copied by the CPU before returning.
+ * 
+ * @param destination of the copy, not to be used until the callback
+ * @param source of the copy, has to stay valid until the callback. A 
+ *        source in flash is copied by the CPU before returning.
+ * @param bytes to copy
+ * @param callback called when the copy is done, from the µDMA software 
+ *        interrupt or before returning for small blocks. May be nullptr.
+ * @param context passed to the callback
+ * @return false if a transfer is already in progress, nothing is copied
+ */
+bool DmaMemory::copyAsync(void* destination, const void* source, uint32_t bytes, void (*callback)(void*), void* context)
+{
+    if(busy)
+    {
+        return(false);
+    }
+
+    start(destination, source, false, bytes, callback, context);
+    return(true);
+}
+
+/**
+ * @brief Starts filling a block of memory with a byte and returns right
+ *        away. Small blocks are filled by the CPU before returning.
+ * 
+ * @param destination of the fill, not to be used until the callback
+ * @param value of every byte
+ * @param bytes to fill
+ * @param callback called when the fill is done, from the µDMA software 
+ *        interrupt or before returning for small blocks. May be nullptr.
+ * @param context passed to the callback
+ * @return false if a transfer is already in progress, nothing is filled
+ */
+bool DmaMemory::setAsync(void* destination, uint8_t value, uint32_t bytes, void (*callback)(void*), void* context)
+{
+    if(busy)
+    {
+        return(false);
+    }
+
+    fillPattern = (uint32_t)value * 0x01010101;
+    start(destination, (const void*)&fillPattern, true, bytes, callback, context);
+    return(true);
+}
+
+/**
+ * @brief Checks if a transfer is in progress.
+ * 
+ * @return true until the last chunk is done
+ */
+bool DmaMemory::isBusy(void)
+{
+    return(busy);
+}
+
+/**
+ * @brief Starts a copy or a fill. Picks the largest item size the addresses
+ *        and the size allow, and does small blocks, every block without
+ *        a channel and copies from flash, which the µDMA can not read, with
+ *        the CPU.
+ */
+void DmaMemory::start(void* destination, const void* source, bool fill, uint32_t bytes, void (*callback)(void*), void* context)
+{
+    if((bytes < cpuThreshold) || !channel.isAllocated() || !Dma::reachable((uint32_t)(uintptr_t)source))
+    {
+        if(fill)
+        {
+            memset(destination, (int)(fillPattern & 0xFF), bytes);
+        }
+
+        else
+        {
+            memcpy(destination, source, bytes);
+        }
+
+        if(callback != nullptr)
+        {
+            callback(context);
+        }
+
+        return;
+    }
+
+    destinationAddress = (uint32_t)(uintptr_t)destination;
+    sourceAddress = (uint32_t)(uintptr_t)source;
+    fillMode = fill;
+    DmaMemory::callback = callback;
+    DmaMemory::context = context;
+
+    uint32_t alignment = destinationAddress | bytes | (fill ? 0 : sourceAddress);
+    itemSize = ((alignment & 0x3) == 0) ? dmaDataSize::_32Bit : (((alignment & 0x1) == 0) ? dmaDataSize::_16Bit : dmaDataSize::_8Bit);
+    remainingItems = bytes >> (uint32_t)itemSize;
+
+    busy = true;
+    startChunk();
+}
+
+/**
+ * @brief Starts the next chunk of up to 1024 items in auto mode with a 
+ *        software request.
+ */
+void DmaMemory::startChunk(void)
+{
+    uint32_t items = (remainingItems > 1024) ? 1024 : remainingItems;
+
+    channel.clearComplete();
+    channel.transfer(dmaTransferMode::autoRequest, (const volatile void*)(uintptr_t)sourceAddress, fillMode ? dmaIncrement::none : (dmaIncrement)itemSize,
+        (volatile void*)(uintptr_t)destinationAddress, (dmaIncrement)itemSize, itemSize, items, dmaArbitrationSize::_8);
+
+    remainingItems -= items;
+    destinationAddress += items << (uint32_t)itemSize;
+    sourceAddress += fillMode ? 0 : (items << (uint32_t)itemSize);
+
+    channel.enable();
+    channel.requestTransfer();
+}
+
+/**
+ * @brief Services the µDMA software interrupt. Starts the next chunk, or 
+ *        ends the transfer and calls the callback after the last one.
+ */
+void DmaMemory::dispatch(void)
+{
+    if(!channel.isComplete())
+    {
+        return;
+    }
+
+    channel.clearComplete();
+
+    if(!busy)
+    {
+        return;
+    }
+
+    if(remainingItems != 0)
+    {
+        startChunk();
+        return;
+    }
+
+    busy = false;
+
+    if(callback != nullptr)
+    {
+        callback(context);
+    }
+}
+
+extern "C" void uDMA_Software_Handler(void)
+{
+    DmaMemory::dispatch();
+}
@@ -0,0 +1,106 @@
+/**
+ * @file dmaMemory.h
+ * @brief TM4C123GH6PM µDMA Memory Copy and Fill Declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/17/2026
+ * @copyright Matthew Hardenburgh 2020
+ * 
+ * 
+ * @section license LICENSE
+ * 
+ * TM4C123GH6PM Drivers
+ * Copyright (C) 2020  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class DmaMemory
+ * @brief µDMA Memory Copy and Fill on the Software Channel
+ * 
+ * @section dmaMemoryDescription DMA Memory Description
+ * 
+ * DmaMemory moves and fills blocks of memory with a software channel from 
+ * the allocator, channel 30 unless it is taken, in auto mode. Each transfer
+ * is split in chunks of up to 1024 items, using 32-bit items when the 
+ * addresses and the size are word aligned, 16-bit or 8-bit items otherwise.
+ * If \c initialize gets no channel every block is handled by the CPU, and 
+ * the asynchronous calls finish before returning.
+ * 
+ * \c copy and \c set wait for the transfer to finish. \c copyAsync and 
+ * \c setAsync return right away and the CPU keeps running while the 
+ * controller moves the data, the next chunk is started from the µDMA 
+ * software interrupt and the callback is called from it once the whole 
+ * block is done. Blocks smaller than \c cpuThreshold bytes are handled by 
+ * the CPU since setting up the channel would take longer than the copy.
+ * The µDMA can only read SRAM and the peripherals, so copies from a 
+ * \c const table in flash are handled by the CPU as well.
+ * 
+ * The controller shares the bus with the CPU. The gain of the asynchronous
+ * calls is the CPU time left to other code while the block moves.
+ * \c benchmarks/dmaMemoryBenchmark.cpp compares the throughput with memcpy
+ * and memset and measures the CPU left free on the board.
+ * 
+ * @code
+ * DmaMemory::initialize(3);
+ * DmaMemory::copyAsync(frameBuffer, nextFrame, sizeof(nextFrame), frameCopied, &display);
+ * @endcode
+ */
+
+#ifndef DMA_MEMORY_H
+#define DMA_MEMORY_H
+
+#include "udma.h"
+
+class DmaMemory
+{
+    public:
+        DmaMemory();
+        ~DmaMemory();
+
+        static bool initialize(uint32_t interruptPriority);
+
+        static void copy(void* destination, const void* source, uint32_t bytes);
+        static void set(void* destination, uint8_t value, uint32_t bytes);
+        static bool copyAsync(void* destination, const void* source, uint32_t bytes, void (*callback)(void*), void* context);
+        static bool setAsync(void* destination, uint8_t value, uint32_t bytes, void (*callback)(void*), void* context);
+        static bool isBusy(void);
+
+        static void dispatch(void);
+
+        static const uint32_t cpuThreshold = 64;
+
+    private:
+
+        static void start(void* destination, const void* source, bool fill, uint32_t bytes, void (*callback)(void*), void* context);
+        static void startChunk(void);
+
+        static Dma channel;
+
+        static volatile bool busy;
+
+        static uint32_t destinationAddress;
+        static uint32_t sourceAddress;
+        static uint32_t remainingItems;
+        static dmaDataSize itemSize;
+        static bool fillMode;
+        static volatile uint32_t fillPattern;
+
+        static void (*callback)(void*);
+        static void* context;
+};
+
+#endif //DMA_MEMORY_H
@@ -29,12 +29,29 @@
 
 #include "udma.h"
 
+bool Dma::moduleInitialized = false;
+
+volatile uint32_t Dma::controlTable[256] __attribute__((section(".udma_table"), aligned(1024)));
+
+Dma* Dma::channelOwner[32] = {};
+bool Dma::allocationConflict = false;
+
+constexpr DmaAssignment Dma::channelMap[Dma::numberOfAssignments];
+
+//Timer 2 A and B are carried on three channels each, 4 and 5, 6 and 7, 14 and 15
+static_assert(Dma::assignable(0, dmaPeripheral::timer2A, dmaPeripheral::timer2A, dmaPeripheral::timer2A, dmaPeripheral::timer2B, dmaPeripheral::timer2B, dmaPeripheral::timer2B), "µDMA channel map is missing a Timer 2 channel");
+static_assert(Dma::freeChannelFor(dmaPeripheral::timer2A, (1u << 4)) == 6, "µDMA channel map is out of the Table 9-1 order");
+
+const uint32_t Dma::DMACHMAPn_OFFSET[4] = {DMACHMAP0_OFFSET, DMACHMAP1_OFFSET, DMACHMAP2_OFFSET, DMACHMAP3_OFFSET};
+
 /**
- * @brief empty constructor placeholder
+ * @brief Constructs a Dma object without a channel, channel operations do
+ *        nothing until \c initialize or \c allocate succeeds.
  */
 Dma::Dma()
 {
-
+    channel = noChannel;
+    pingPongCallback = nullptr;
 }
 
 /**
@@ -43,4 +60,528 @@ Dma::Dma()
 Dma::~Dma()
 {
 
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Enables the μDMA module and points it at the channel control table.
+ *        Only done once, later calls return right away.
+ */
+void Dma::initializeModule(void)
+{
+    if(moduleInitialized == true)
+    {
+        return;
+    }
+
+    //1. Enable the μDMA clock
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + RCGCDMA_OFFSET)), (uint32_t)setORClear::set, 0, 1, RW);
+    while(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(systemControlBase + PRDMA_OFFSET)), 0, 1, RO) == 0)
+    {
+        //Ready?
+    }
+
+    //2. Enable the μDMA controller, MASTEN
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(uDMA_Base + DMACFG_OFFSET)), (uint32_t)setORClear::set, 0, 1, RW);
+
+    //3. Location of the channel control table
+    (*((volatile uint32_t*)(uDMA_Base + DMACTLBASE_OFFSET))) = (uint32_t)(uintptr_t)controlTable;
+
+    moduleInitialized = true;
+}
+
+/**
+ * @brief Initializes a μDMA channel and assigns it to a peripheral.
+ * 
+ * @param channel number, 0 to 31
+ * @param encoding of the peripheral in the channel map, 0 to 4
+ * @return false if the channel is in use by another driver or out of range,
+ *         the channel held before is kept
+ */
+bool Dma::initialize(uint32_t channel, uint32_t encoding)
+{
+    if((channel >= noChannel) || (encoding > 4))
+    {
+        return(false);
+    }
+
+    if((channelOwner[channel] != nullptr) && (channelOwner[channel] != this))
+    {
+        allocationConflict = true;
+        return(false);
+    }
+
+    if((*this).channel != channel)
+    {
+        release();
+    }
+
+    channelOwner[channel] = this;
+    (*this).channel = channel;
+
+    initializeModule();
+
+    //1. Assign the channel to the peripheral
+    Register::setRegisterBitFieldStatus(((volatile uint32_t*)(uDMA_Base + DMACHMAPn_OFFSET[channel/8])), encoding, (channel%8)*4, 4, RW);
+
+    //2. Default priority, use the primary control structure, respond to single and burst requests and do not mask requests
+    (*((volatile uint32_t*)(uDMA_Base + DMAPRIOCLR_OFFSET))) = (1 << channel);
+    (*((volatile uint32_t*)(uDMA_Base + DMAALTCLR_OFFSET))) = (1 << channel);
+    (*((volatile uint32_t*)(uDMA_Base + DMAUSEBURSTCLR_OFFSET))) = (1 << channel);
+    (*((volatile uint32_t*)(uDMA_Base + DMAREQMASKCLR_OFFSET))) = (1 << channel);
+
+    return(true);
+}
+
+/**
+ * @brief Allocates the first free channel that carries a peripheral request
+ *        and assigns it to the peripheral. The channel held before is kept
+ *        if it carries the request.
+ * 
+ * @param peripheral request the channel is for
+ * @return false if every channel carrying the request is in use by another
+ *         driver, the channel held before is kept
+ */
+bool Dma::allocate(dmaPeripheral peripheral)
+{
+    for(uint32_t entry = 0; entry < numberOfAssignments; entry++)
+    {
+        if((channelMap[entry].peripheral == peripheral) && (channelMap[entry].channel == channel))
+        {
+            return(initialize(channel, channelMap[entry].encoding));
+        }
+    }
+
+    for(uint32_t entry = 0; entry < numberOfAssignments; entry++)
+    {
+        if((channelMap[entry].peripheral == peripheral) && (channelOwner[channelMap[entry].channel] == nullptr))
+        {
+            return(initialize(channelMap[entry].channel, channelMap[entry].encoding));
+        }
+    }
+
+    allocationConflict = true;
+    return(false);
+}
+
+/**
+ * @brief Disables the channel and gives it back to the allocator.
+ */
+void Dma::release(void)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    if(channelOwner[channel] == this)
+    {
+        disable();
+        channelOwner[channel] = nullptr;
+    }
+
+    channel = noChannel;
+}
+
+/**
+ * @brief Checks if the object holds a channel.
+ * 
+ * @return true after a successful \c initialize or \c allocate
+ */
+bool Dma::isAllocated(void)
+{
+    return(channel != noChannel);
+}
+
+/**
+ * @brief Checks if a channel was refused because it was in use by another
+ *        driver.
+ * 
+ * @return true if a conflict was detected
+ */
+bool Dma::hasAllocationConflict(void)
+{
+    return(allocationConflict);
+}
+
+/**
+ * @brief Writes the primary control structure of the channel. The channel
+ *        has to be enabled afterwards to start the transfer.
+ * 
+ * @param mode of the transfer
+ * @param source address of the first item
+ * @param sourceIncrement after each item
+ * @param destination address of the first item
+ * @param destinationIncrement after each item
+ * @param size of each item
+ * @param numberOfItems to transfer, 1 to 1024
+ * @param arbitration number of items transferred per request
+ */
+void Dma::transfer(dmaTransferMode mode, const volatile void* source, dmaIncrement sourceIncrement, volatile void* destination, dmaIncrement destinationIncrement, dmaDataSize size, uint32_t numberOfItems, dmaArbitrationSize arbitration)
+{
+    if((channel == noChannel) || (numberOfItems == 0) || (numberOfItems > 1024))
+    {
+        return;
+    }
+
+    writeStructure(channel, endPointer(source, sourceIncrement, numberOfItems), endPointer(destination, destinationIncrement, numberOfItems), controlWordFor(mode, sourceIncrement, destinationIncrement, size, numberOfItems, arbitration));
+}
+
+/**
+ * @brief Starts a ping-pong transfer between two buffers. Buffer A is moved
+ *        by the primary control structure and buffer B by the alternate 
+ *        one, the channel keeps switching between them until it is 
+ *        disabled. Either the source or the destination buffers usually 
+ *        point at the same peripheral register.
+ * 
+ * @param sourceA source of the primary structure
+ * @param sourceB source of the alternate structure
+ * @param sourceIncrement after each item
+ * @param destinationA destination of the primary structure
+ * @param destinationB destination of the alternate structure
+ * @param destinationIncrement after each item
+ * @param size of each item
+ * @param numberOfItems in each half, 1 to 1024
+ * @param arbitration number of items transferred per request
+ * @param callback called from \c servicePingPong with the context and the
+ *        completed half, may be nullptr
+ * @param context passed to the callback
+ */
+void Dma::startPingPong(const volatile void* sourceA, const volatile void* sourceB, dmaIncrement sourceIncrement, volatile void* destinationA, volatile void* destinationB, dmaIncrement destinationIncrement, dmaDataSize size, uint32_t numberOfItems, dmaArbitrationSize arbitration, void (*callback)(void*, uint32_t), void* context)
+{
+    if((channel == noChannel) || (numberOfItems == 0) || (numberOfItems > 1024))
+    {
+        return;
+    }
+
+    pingPongSourceEnd[0] = endPointer(sourceA, sourceIncrement, numberOfItems);
+    pingPongSourceEnd[1] = endPointer(sourceB, sourceIncrement, numberOfItems);
+    pingPongDestinationEnd[0] = endPointer(destinationA, destinationIncrement, numberOfItems);
+    pingPongDestinationEnd[1] = endPointer(destinationB, destinationIncrement, numberOfItems);
+    pingPongControl = controlWordFor(dmaTransferMode::pingPong, sourceIncrement, destinationIncrement, size, numberOfItems, arbitration);
+    pingPongCallback = callback;
+    pingPongContext = context;
+
+    writeStructure(channel, pingPongSourceEnd[0], pingPongDestinationEnd[0], pingPongControl);
+    writeStructure(alternateStructure + channel, pingPongSourceEnd[1], pingPongDestinationEnd[1], pingPongControl);
+
+    clearComplete();
+    (*((volatile uint32_t*)(uDMA_Base + DMAALTCLR_OFFSET))) = (1 << channel);
+    enable();
+}
+
+/**
+ * @brief Services the completion of one half of a ping-pong transfer. 
+ *        Re-arms the control structure that completed and calls the 
+ *        callback with the half that completed. Called from the completion
+ *        interrupt, on the vector of the peripheral of the channel.
+ */
+void Dma::servicePingPong(void)
+{
+    if(!isComplete())
+    {
+        return;
+    }
+
+    clearComplete();
+
+    //The controller has switched to the other structure, the one not active completed
+    uint32_t completedHalf = isAlternateActive() ? 0 : 1;
+
+    writeStructure((completedHalf * alternateStructure) + channel, pingPongSourceEnd[completedHalf], pingPongDestinationEnd[completedHalf], pingPongControl);
+
+    if(pingPongCallback != nullptr)
+    {
+        pingPongCallback(pingPongContext, completedHalf);
+    }
+}
+
+/**
+ * @brief Calls \c servicePingPong, in the form of an interrupt callback of 
+ *        the other drivers.
+ * 
+ * @param dma channel to be serviced
+ */
+void Dma::pingPongComplete(void* dma)
+{
+    (*((Dma*)dma)).servicePingPong();
+}
+
+/**
+ * @brief Checks which control structure the channel is using.
+ * 
+ * @return true if the alternate structure is active
+ */
+bool Dma::isAlternateActive(void)
+{
+    if(channel == noChannel)
+    {
+        return(false);
+    }
+
+    return(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(uDMA_Base + DMAALTSET_OFFSET)), channel, 1, RW) == (uint32_t)setORClear::set);
+}
+
+/**
+ * @brief Starts a scatter-gather list. The primary control structure copies
+ *        each task, 4 words, into the alternate structure which then runs 
+ *        it. A memory list runs completely after a software request issued 
+ *        here, a peripheral list runs one task per request of the 
+ *        peripheral of the channel. The channel stops after the last task.
+ * 
+ * @param tasks list built with \c task, in SRAM, has to stay valid until 
+ *        the list is done
+ * @param numberOfTasks in the list, 1 to 256
+ * @param type of the list, has to match the type the tasks were built for
+ * @return false if the list or the source of one of its tasks is in flash,
+ *         which the µDMA can not read, nothing is started
+ */
+bool Dma::startScatterGather(const DmaTask* tasks, uint32_t numberOfTasks, dmaScatterGather type)
+{
+    if((channel == noChannel) || (numberOfTasks == 0) || (numberOfTasks > 256) || !reachable((uint32_t)(uintptr_t)tasks))
+    {
+        return(false);
+    }
+
+    for(uint32_t i = 0; i < numberOfTasks; i++)
+    {
+        if(!reachable(tasks[i].sourceEnd))
+        {
+            return(false);
+        }
+    }
+
+    uint32_t sourceEnd = (uint32_t)(uintptr_t)(&tasks[numberOfTasks - 1].unused);
+    uint32_t destinationEnd = (uint32_t)(uintptr_t)(&controlTable[((alternateStructure + channel)*4) + 3]);
+    dmaTransferMode mode = (type == dmaScatterGather::memory) ? dmaTransferMode::memoryScatterGather : dmaTransferMode::peripheralScatterGather;
+
+    writeStructure(channel, sourceEnd, destinationEnd, controlWordFor(mode, dmaIncrement::_32Bit, dmaIncrement::_32Bit, dmaDataSize::_32Bit, numberOfTasks * 4, dmaArbitrationSize::_4));
+
+    clearComplete();
+    (*((volatile uint32_t*)(uDMA_Base + DMAALTCLR_OFFSET))) = (1 << channel);
+    enable();
+
+    if(type == dmaScatterGather::memory)
+    {
+        requestTransfer();
+    }
+
+    return(true);
+}
+
+/**
+ * @brief Writes a channel control structure.
+ * 
+ * @param structure number, the channel for the primary structure and 32 
+ *        plus the channel for the alternate structure
+ * @param source end pointer
+ * @param destination end pointer
+ * @param controlWord of the structure
+ */
+void Dma::writeStructure(uint32_t structure, uint32_t sourceEnd, uint32_t destinationEnd, uint32_t controlWord)
+{
+    controlTable[(structure*4) + 0] = sourceEnd;
+    controlTable[(structure*4) + 1] = destinationEnd;
+    controlTable[(structure*4) + 2] = controlWord;
+}
+
+/**
+ * @brief Enables the channel. The channel waits for requests from its 
+ *        peripheral, or a software request.
+ */
+void Dma::enable(void)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + DMAENASET_OFFSET))) = (1 << channel);
+}
+
+/**
+ * @brief Disables the channel.
+ */
+void Dma::disable(void)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + DMAENACLR_OFFSET))) = (1 << channel);
+}
+
+/**
+ * @brief Checks if the channel is enabled. The controller disables the 
+ *        channel when the transfer is complete.
+ * 
+ * @return true while the transfer is in progress
+ */
+bool Dma::isEnabled(void)
+{
+    if(channel == noChannel)
+    {
+        return(false);
+    }
+
+    return(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(uDMA_Base + DMAENASET_OFFSET)), channel, 1, RW) == (uint32_t)setORClear::set);
+}
+
+/**
+ * @brief Checks the completion interrupt status of the channel. The 
+ *        completion interrupt of a peripheral channel is raised on the 
+ *        interrupt vector of the peripheral.
+ * 
+ * @return true if the transfer of the channel completed
+ */
+bool Dma::isComplete(void)
+{
+    if(channel == noChannel)
+    {
+        return(false);
+    }
+
+    return(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(uDMA_Base + DMACHIS_OFFSET)), channel, 1, RW1C) == (uint32_t)setORClear::set);
+}
+
+/**
+ * @brief Clears the completion interrupt status of the channel.
+ */
+void Dma::clearComplete(void)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + DMACHIS_OFFSET))) = (1 << channel);
+}
+
+/**
+ * @brief Gets the number of items the primary control structure still has
+ *        to transfer.
+ * 
+ * @return remaining items, 0 once the transfer is complete
+ */
+uint32_t Dma::getRemainingItems(void)
+{
+    if(channel == noChannel)
+    {
+        return(0);
+    }
+
+    uint32_t control = controlTable[(channel*4) + 2];
+
+    if((control & 0x7) == (uint32_t)dmaTransferMode::stop)
+    {
+        return(0);
+    }
+
+    return(((control >> 4) & 0x3FF) + 1);
+}
+
+/**
+ * @brief Selects the priority of the channel. High priority channels are
+ *        serviced before default priority channels, then lower channel 
+ *        numbers first.
+ * 
+ * @param highPriority true for high priority, false for default priority
+ */
+void Dma::setHighPriority(bool highPriority)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + ((highPriority == true) ? DMAPRIOSET_OFFSET : DMAPRIOCLR_OFFSET)))) = (1 << channel);
+}
+
+/**
+ * @brief Selects if the channel only responds to burst requests of its 
+ *        peripheral, single requests are ignored.
+ * 
+ * @param burstOnly true to ignore single requests
+ */
+void Dma::setBurstOnly(bool burstOnly)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + ((burstOnly == true) ? DMAUSEBURSTSET_OFFSET : DMAUSEBURSTCLR_OFFSET)))) = (1 << channel);
+}
+
+/**
+ * @brief Masks the requests of the peripheral of the channel. A masked 
+ *        channel only transfers on software requests, and the peripheral
+ *        raises its own interrupt instead.
+ * 
+ * @param masked true to ignore peripheral requests
+ */
+void Dma::maskRequests(bool masked)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + ((masked == true) ? DMAREQMASKSET_OFFSET : DMAREQMASKCLR_OFFSET)))) = (1 << channel);
+}
+
+/**
+ * @brief Checks for a bus error. The controller disables the channel that
+ *        caused it.
+ * 
+ * @return true if a bus error happened
+ */
+bool Dma::hasBusError(void)
+{
+    return(Register::getRegisterBitFieldStatus(((volatile uint32_t*)(uDMA_Base + DMAERRCLR_OFFSET)), 0, 1, RW1C) == (uint32_t)setORClear::set);
+}
+
+/**
+ * @brief Clears the bus error status.
+ */
+void Dma::clearBusError(void)
+{
+    (*((volatile uint32_t*)(uDMA_Base + DMAERRCLR_OFFSET))) = 0x1;
+}
+
+/**
+ * @brief Issues a software request on the channel.
+ */
+void Dma::requestTransfer(void)
+{
+    if(channel == noChannel)
+    {
+        return;
+    }
+
+    (*((volatile uint32_t*)(uDMA_Base + DMASWREQ_OFFSET))) = (1 << channel);
+}
+
+/**
+ * @brief Gets the channel number.
+ * 
+ * @return channel number, 0 to 31, \c noChannel if none is held
+ */
+uint32_t Dma::getChannel(void)
+{
+    return(channel);
+}
+
+/**
+ * @brief Computes the end pointer of a transfer, the address of the last
+ *        item.
+ * 
+ * @param start address of the first item
+ * @param increment after each item
+ * @param numberOfItems in the transfer
+ * @return end pointer
+ */
+uint32_t Dma::endPointer(const volatile void* start, dmaIncrement increment, uint32_t numberOfItems)
+{
+    return(endAddress((uint32_t)(uintptr_t)start, increment, numberOfItems));
+}
@@ -69,6 +69,71 @@
  * For more detailed information on the μDMA please see page 585 of the 
  * TM4C123GH6PM datasheet @ https://www.ti.com/lit/ds/symlink/tm4c123gh6pm.pdf
  * 
+ * Before a channel is used \c initialize assigns it to a peripheral with the
+ * encoding from the table below, this also enables the μDMA module and sets
+ * up the channel control table on first use. \c transfer writes the primary
+ * control structure of the channel and \c enable starts it. A channel stops,
+ * and disables itself, once all items have been transferred.
+ * 
+ * In basic mode the channel moves \c arbitration items per request from its
+ * peripheral. In auto mode (\c dmaTransferMode::autoRequest) a single 
+ * request, from \c requestTransfer for example, moves the whole transfer 
+ * which suits memory to memory copies. Channel configuration is done with 
+ * single stores to the SET and CLR registers, so it is safe against other
+ * channels being changed from interrupts. \c isComplete and 
+ * \c clearComplete read and clear the completion status of the channel, 
+ * \c getRemainingItems gives the progress of a transfer.
+ * 
+ * \c startPingPong streams without gaps between two buffers. The primary 
+ * control structure moves buffer A and the alternate structure buffer B, 
+ * when one completes the controller switches to the other on the next 
+ * request. \c servicePingPong is called from the completion interrupt, on 
+ * the vector of the peripheral of the channel, it re-arms the structure 
+ * that completed with three stores and calls the callback with the half, 0
+ * for A and 1 for B, that can be processed or refilled. \c pingPongComplete
+ * can be registered directly as the interrupt callback of a driver with the
+ * channel as context. The callback has to finish before the other half 
+ * completes.
+ * 
+ * \c startScatterGather runs a list of up to 256 tasks, each a control 
+ * structure built with \c Dma::task, from a single request. The controller
+ * copies each task into the alternate structure of the channel and runs it,
+ * so a whole transaction, a command and its data to the SSI followed by the
+ * chip select on a GPIO for example, is done without the CPU. In memory 
+ * scatter-gather one request runs the whole list, in peripheral 
+ * scatter-gather each task waits for a request of the peripheral. \c task
+ * is \c constexpr, a list made of constant addresses, like peripheral 
+ * registers, is built at compile time. The µDMA can only reach SRAM and the
+ * peripherals, not flash, so the list and the sources of its tasks have to
+ * be in SRAM. A list declared \c static but not \c const is copied from 
+ * flash into SRAM by the startup code. \c startScatterGather refuses a 
+ * list, or a task source, below the start of SRAM, \c Dma::reachable makes
+ * the same check for the other transfers.
+ * 
+ * @code
+ * static DmaTask transaction[] = {
+ *     Dma::task(dmaScatterGather::peripheral, false, commandAddress, dmaIncrement::_8Bit, ssi0Data, dmaIncrement::none, dmaDataSize::_8Bit, 4, dmaArbitrationSize::_4),
+ *     Dma::task(dmaScatterGather::peripheral, true, chipSelectHigh, dmaIncrement::none, gpioDataCs, dmaIncrement::none, dmaDataSize::_32Bit, 1, dmaArbitrationSize::_1)};
+ * ssiTx.startScatterGather(transaction, 2, dmaScatterGather::peripheral);
+ * @endcode
+ * 
+ * Drivers get their channel with \c allocate and a \c dmaPeripheral, which
+ * looks the request up in the channel map below and takes the first channel
+ * that carries it and is still free, then writes DMACHMAPn once. A request
+ * with no free channel left is refused instead of remapping a channel in 
+ * use by another driver, and \c hasAllocationConflict reports it. A Dma 
+ * without a channel, before a successful \c allocate or after \c release,
+ * ignores every channel operation; \c isAllocated tells them apart. 
+ * Allocating again keeps the channel held before when it carries the 
+ * request, otherwise the channel moves to the first free one. When the 
+ * assignments are known at compile time \c Dma::assignable makes the same
+ * choices in a \c static_assert, with the requests in the order the drivers
+ * allocate them.
+ * 
+ * @code
+ * static_assert(Dma::assignable(0, dmaPeripheral::timer1A, dmaPeripheral::uart1Rx, dmaPeripheral::adc0Ss3), "µDMA channel conflict");
+ * @endcode
+ * 
  * @subsection udmaSignalDescription μDMA Signal Description
  * 
  * Each DMA channel can be programmed with up to 5 possible assignments. There
@@ -100,14 +165,255 @@
 
 #include "../systemControl/systemControl.h"
 
+/**
+ * Transfer mode of a channel control structure, XFERMODE.
+ */
+enum class dmaTransferMode{stop, basic, autoRequest, pingPong, memoryScatterGather, alternateMemoryScatterGather, peripheralScatterGather, alternatePeripheralScatterGather};
+
+/**
+ * Size of each data item, SRCSIZE and DSTSIZE.
+ */
+enum class dmaDataSize{_8Bit, _16Bit, _32Bit};
+
+/**
+ * Address increment after each data item, SRCINC and DSTINC.
+ */
+enum class dmaIncrement{_8Bit, _16Bit, _32Bit, none};
+
+/**
+ * Number of items transferred before the controller re-arbitrates, ARBSIZE.
+ */
+enum class dmaArbitrationSize{_1, _2, _4, _8, _16, _32, _64, _128, _256, _512, _1024};
+
+/**
+ * Peripheral requests that can be assigned to a μDMA channel.
+ */
+enum class dmaPeripheral
+{
+    usbEndpoint1Rx, usbEndpoint1Tx, usbEndpoint2Rx, usbEndpoint2Tx, usbEndpoint3Rx, usbEndpoint3Tx,
+    uart0Rx, uart0Tx, uart1Rx, uart1Tx, uart2Rx, uart2Tx, uart3Rx, uart3Tx, uart4Rx, uart4Tx, uart5Rx, uart5Tx, uart6Rx, uart6Tx, uart7Rx, uart7Tx,
+    ssi0Rx, ssi0Tx, ssi1Rx, ssi1Tx, ssi2Rx, ssi2Tx, ssi3Rx, ssi3Tx,
+    adc0Ss0, adc0Ss1, adc0Ss2, adc0Ss3, adc1Ss0, adc1Ss1, adc1Ss2, adc1Ss3,
+    timer0A, timer0B, timer1A, timer1B, timer2A, timer2B, timer3A, timer3B, timer4A, timer4B, timer5A, timer5B,
+    wideTimer0A, wideTimer0B, wideTimer1A, wideTimer1B, wideTimer2A, wideTimer2B, wideTimer3A, wideTimer3B, wideTimer4A, wideTimer4B, wideTimer5A, wideTimer5B,
+    gpioA, gpioB, gpioC, gpioD, gpioE, gpioF, software
+};
+
+/**
+ * One assignment of the channel map, a peripheral request on a channel with
+ * its DMACHMAPn encoding.
+ */
+struct DmaAssignment
+{
+    dmaPeripheral peripheral;
+    uint32_t channel;
+    uint32_t encoding;
+};
+
+/**
+ * Scatter-gather list run from a single software request or one task per
+ * peripheral request.
+ */
+enum class dmaScatterGather{memory, peripheral};
+
+/**
+ * One task of a scatter-gather list, laid out as a channel control 
+ * structure.
+ */
+struct DmaTask
+{
+    uint32_t sourceEnd;
+    uint32_t destinationEnd;
+    uint32_t control;
+    uint32_t unused;
+};
+
 class Dma
 {
     public:
         Dma();
         ~Dma();
 
+        static void initializeModule(void);
+
+        bool initialize(uint32_t channel, uint32_t encoding);
+        bool allocate(dmaPeripheral peripheral);
+        void release(void);
+        bool isAllocated(void);
+        static bool hasAllocationConflict(void);
+
+        /**
+         * @brief First free channel that carries a peripheral request.
+         * 
+         * @param peripheral request
+         * @param usedChannels bit n set for channel n in use
+         * @param entry of the channel map to start from
+         * @return channel, 32 if none is free
+         */
+        static constexpr uint32_t freeChannelFor(dmaPeripheral peripheral, uint32_t usedChannels, uint32_t entry = 0)
+        {
+            return((entry >= numberOfAssignments) ? 32 :
+                (((channelMap[entry].peripheral == peripheral) && ((usedChannels & (1u << channelMap[entry].channel)) == 0)) ? channelMap[entry].channel : freeChannelFor(peripheral, usedChannels, entry + 1)));
+        }
+
+        /**
+         * @brief Checks at compile time that every peripheral request gets a
+         *        channel, allocated in the order given.
+         * 
+         * @param usedChannels bit n set for channel n already in use
+         * @return true if there is no conflict
+         */
+        static constexpr bool assignable(uint32_t usedChannels)
+        {
+            return((void)usedChannels, true);
+        }
+
+        template<typename... Peripherals>
+        static constexpr bool assignable(uint32_t usedChannels, dmaPeripheral first, Peripherals... rest)
+        {
+            return((freeChannelFor(first, usedChannels) < 32) && assignable(usedChannels | (1u << (freeChannelFor(first, usedChannels) & 0x1F)), rest...));
+        }
+        void transfer(dmaTransferMode mode, const volatile void* source, dmaIncrement sourceIncrement, volatile void* destination, dmaIncrement destinationIncrement, dmaDataSize size, uint32_t numberOfItems, dmaArbitrationSize arbitration);
+        void enable(void);
+        void disable(void);
+        bool isEnabled(void);
+        void startPingPong(const volatile void* sourceA, const volatile void* sourceB, dmaIncrement sourceIncrement, volatile void* destinationA, volatile void* destinationB, dmaIncrement destinationIncrement, dmaDataSize size, uint32_t numberOfItems, dmaArbitrationSize arbitration, void (*callback)(void*, uint32_t), void* context);
+        void servicePingPong(void);
+        static void pingPongComplete(void* dma);
+        bool isAlternateActive(void);
+
+        bool startScatterGather(const DmaTask* tasks, uint32_t numberOfTasks, dmaScatterGather type);
+
+        /**
+         * @brief Checks if the µDMA can read an address, SRAM and the 
+         *        peripherals are above \c sramBase, flash is below it.
+         * 
+         * @param address to be read by the µDMA
+         * @return false for an address in flash
+         */
+        static constexpr bool reachable(uint32_t address)
+        {
+            return(address >= sramBase);
+        }
+
+        /**
+         * @brief Builds one task of a scatter-gather list. Every task but the
+         *        last continues the list, the last one ends it.
+         * 
+         * @param type of the list the task belongs to
+         * @param last true for the last task of the list
+         * @param source address of the first item
+         * @param sourceIncrement after each item
+         * @param destination address of the first item
+         * @param destinationIncrement after each item
+         * @param size of each item
+         * @param numberOfItems to transfer, 1 to 1024
+         * @param arbitration number of items transferred per request
+         * @return task to be put in the list
+         */
+        static constexpr DmaTask task(dmaScatterGather type, bool last, uint32_t source, dmaIncrement sourceIncrement, uint32_t destination, dmaIncrement destinationIncrement, dmaDataSize size, uint32_t numberOfItems, dmaArbitrationSize arbitration)
+        {
+            return(DmaTask{endAddress(source, sourceIncrement, numberOfItems), endAddress(destination, destinationIncrement, numberOfItems),
+                controlWordFor((last == true) ? ((type == dmaScatterGather::memory) ? dmaTransferMode::autoRequest : dmaTransferMode::basic) : ((type == dmaScatterGather::memory) ? dmaTransferMode::alternateMemoryScatterGather : dmaTransferMode::alternatePeripheralScatterGather),
+                sourceIncrement, destinationIncrement, size, numberOfItems, arbitration), 0});
+        }
+
+        /**
+         * @brief Address of the last item of a transfer, the end pointer of a
+         *        control structure.
+         */
+        static constexpr uint32_t endAddress(uint32_t start, dmaIncrement increment, uint32_t numberOfItems)
+        {
+            return((increment == dmaIncrement::none) ? start : (start + ((numberOfItems - 1) << (uint32_t)increment)));
+        }
+
+        /**
+         * @brief Control word of a channel control structure, DMACHCTL.
+         */
+        static constexpr uint32_t controlWordFor(dmaTransferMode mode, dmaIncrement sourceIncrement, dmaIncrement destinationIncrement, dmaDataSize size, uint32_t numberOfItems, dmaArbitrationSize arbitration)
+        {
+            return(((uint32_t)destinationIncrement << 30) | ((uint32_t)size << 28) | ((uint32_t)sourceIncrement << 26) | ((uint32_t)size << 24) |
+                ((uint32_t)arbitration << 14) | ((numberOfItems - 1) << 4) | (uint32_t)mode);
+        }
+
+        bool isComplete(void);
+        void clearComplete(void);
+        uint32_t getRemainingItems(void);
+
+        void setHighPriority(bool highPriority);
+        void setBurstOnly(bool burstOnly);
+        void maskRequests(bool masked);
+
+        static bool hasBusError(void);
+        static void clearBusError(void);
+        void requestTransfer(void);
+        uint32_t getChannel(void);
+
+        static const uint32_t noChannel = 32;
+        static const uint32_t sramBase = 0x20000000;
+
     private:
 
+        static uint32_t endPointer(const volatile void* start, dmaIncrement increment, uint32_t numberOfItems);
+        void writeStructure(uint32_t structure, uint32_t sourceEnd, uint32_t destinationEnd, uint32_t controlWord);
+
+        uint32_t channel;
+
+        static Dma* channelOwner[32];
+        static bool allocationConflict;
+
+        static constexpr DmaAssignment channelMap[] = {
+            {dmaPeripheral::usbEndpoint1Rx, 0, 0}, {dmaPeripheral::usbEndpoint1Tx, 1, 0}, {dmaPeripheral::usbEndpoint2Rx, 2, 0}, {dmaPeripheral::usbEndpoint2Tx, 3, 0},
+            {dmaPeripheral::usbEndpoint3Rx, 4, 0}, {dmaPeripheral::usbEndpoint3Tx, 5, 0}, {dmaPeripheral::uart0Rx, 8, 0}, {dmaPeripheral::uart0Tx, 9, 0},
+            {dmaPeripheral::ssi0Rx, 10, 0}, {dmaPeripheral::ssi0Tx, 11, 0}, {dmaPeripheral::adc0Ss0, 14, 0}, {dmaPeripheral::adc0Ss1, 15, 0},
+            {dmaPeripheral::adc0Ss2, 16, 0}, {dmaPeripheral::adc0Ss3, 17, 0}, {dmaPeripheral::timer0A, 18, 0}, {dmaPeripheral::timer0B, 19, 0},
+            {dmaPeripheral::timer1A, 20, 0}, {dmaPeripheral::timer1B, 21, 0}, {dmaPeripheral::uart1Rx, 22, 0}, {dmaPeripheral::uart1Tx, 23, 0},
+            {dmaPeripheral::ssi1Rx, 24, 0}, {dmaPeripheral::ssi1Tx, 25, 0}, {dmaPeripheral::software, 30, 0}, {dmaPeripheral::uart2Rx, 0, 1},
+            {dmaPeripheral::uart2Tx, 1, 1}, {dmaPeripheral::timer3A, 2, 1}, {dmaPeripheral::timer3B, 3, 1}, {dmaPeripheral::timer2A, 4, 1},
+            {dmaPeripheral::timer2B, 5, 1}, {dmaPeripheral::timer2A, 6, 1}, {dmaPeripheral::timer2B, 7, 1}, {dmaPeripheral::uart1Rx, 8, 1},
+            {dmaPeripheral::uart1Tx, 9, 1}, {dmaPeripheral::ssi1Rx, 10, 1}, {dmaPeripheral::ssi1Tx, 11, 1}, {dmaPeripheral::uart2Rx, 12, 1},
+            {dmaPeripheral::uart2Tx, 13, 1}, {dmaPeripheral::timer2A, 14, 1}, {dmaPeripheral::timer2B, 15, 1}, {dmaPeripheral::timer1A, 18, 1},
+            {dmaPeripheral::timer1B, 19, 1}, {dmaPeripheral::adc1Ss0, 24, 1}, {dmaPeripheral::adc1Ss1, 25, 1}, {dmaPeripheral::adc1Ss2, 26, 1},
+            {dmaPeripheral::adc1Ss3, 27, 1}, {dmaPeripheral::uart5Rx, 6, 2}, {dmaPeripheral::uart5Tx, 7, 2}, {dmaPeripheral::uart6Rx, 10, 2},
+            {dmaPeripheral::uart6Tx, 11, 2}, {dmaPeripheral::ssi2Rx, 12, 2}, {dmaPeripheral::ssi2Tx, 13, 2}, {dmaPeripheral::ssi3Rx, 14, 2},
+            {dmaPeripheral::ssi3Tx, 15, 2}, {dmaPeripheral::uart3Rx, 16, 2}, {dmaPeripheral::uart3Tx, 17, 2}, {dmaPeripheral::uart4Rx, 18, 2},
+            {dmaPeripheral::uart4Tx, 19, 2}, {dmaPeripheral::uart7Rx, 20, 2}, {dmaPeripheral::uart7Tx, 21, 2}, {dmaPeripheral::timer4A, 0, 3},
+            {dmaPeripheral::timer4B, 1, 3}, {dmaPeripheral::gpioA, 4, 3}, {dmaPeripheral::gpioB, 5, 3}, {dmaPeripheral::gpioC, 6, 3},
+            {dmaPeripheral::gpioD, 7, 3}, {dmaPeripheral::timer5A, 8, 3}, {dmaPeripheral::timer5B, 9, 3}, {dmaPeripheral::wideTimer0A, 10, 3},
+            {dmaPeripheral::wideTimer0B, 11, 3}, {dmaPeripheral::wideTimer1A, 12, 3}, {dmaPeripheral::wideTimer1B, 13, 3}, {dmaPeripheral::gpioE, 14, 3},
+            {dmaPeripheral::gpioF, 15, 3}, {dmaPeripheral::wideTimer2A, 16, 3}, {dmaPeripheral::wideTimer2B, 17, 3}, {dmaPeripheral::wideTimer3A, 24, 3},
+            {dmaPeripheral::wideTimer3B, 25, 3}, {dmaPeripheral::wideTimer4A, 26, 3}, {dmaPeripheral::wideTimer4B, 27, 3}, {dmaPeripheral::wideTimer5A, 28, 3},
+            {dmaPeripheral::wideTimer5B, 29, 3}, {dmaPeripheral::software, 0, 4}, {dmaPeripheral::software, 1, 4}, {dmaPeripheral::software, 2, 4},
+            {dmaPeripheral::software, 3, 4}, {dmaPeripheral::software, 4, 4}, {dmaPeripheral::software, 5, 4}, {dmaPeripheral::software, 6, 4},
+            {dmaPeripheral::software, 7, 4}, {dmaPeripheral::software, 8, 4}, {dmaPeripheral::software, 9, 4}, {dmaPeripheral::software, 10, 4},
+            {dmaPeripheral::software, 11, 4}, {dmaPeripheral::software, 12, 4}, {dmaPeripheral::software, 13, 4}, {dmaPeripheral::software, 14, 4},
+            {dmaPeripheral::software, 15, 4}, {dmaPeripheral::software, 16, 4}, {dmaPeripheral::software, 17, 4}, {dmaPeripheral::software, 18, 4},
+            {dmaPeripheral::software, 19, 4}, {dmaPeripheral::software, 20, 4}, {dmaPeripheral::software, 21, 4}, {dmaPeripheral::software, 22, 4},
+            {dmaPeripheral::software, 23, 4}, {dmaPeripheral::software, 24, 4}, {dmaPeripheral::software, 25, 4}, {dmaPeripheral::software, 26, 4},
+            {dmaPeripheral::software, 27, 4}, {dmaPeripheral::software, 28, 4}, {dmaPeripheral::software, 29, 4}, {dmaPeripheral::software, 31, 4}};
+        static const uint32_t numberOfAssignments = sizeof(channelMap)/sizeof(channelMap[0]);
+
+        uint32_t pingPongSourceEnd[2];
+        uint32_t pingPongDestinationEnd[2];
+        uint32_t pingPongControl;
+        void (*pingPongCallback)(void*, uint32_t);
+        void* pingPongContext;
+
+        static const uint32_t alternateStructure = 32;
+
+        static bool moduleInitialized;
+
+        /*
+         * Channel control table, 32 primary control structures followed by 
+         * 32 alternate control structures. Each structure is 4 words, source
+         * end pointer, destination end pointer, control word and an unused
+         * word. The table has to be aligned to 1024 bytes, it is placed in
+         * its own section of SRAM by gcc.ld.
+         */
+        static volatile uint32_t controlTable[256] __attribute__((section(".udma_table"), aligned(1024)));
+
+        static const uint32_t DMACHMAPn_OFFSET[4];
+
         static const uint32_t uDMA_Base = 0x400FF000;
 
         static const uint32_t PPDMA_OFFSET = 0x30C; //0x30C PPDMA RO 0x0000.0001 Micro Direct Memory Access Peripheral Present 293